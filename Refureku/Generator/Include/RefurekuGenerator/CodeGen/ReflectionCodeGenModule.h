@@ -8,9 +8,10 @@
 #pragma once
 
 #include <string>
-#include <functional>	//std::hash
 #include <unordered_map>
-#include <algorithm>	//std::all_of
+#include <vector>
+#include <mutex>
+#include <algorithm>	//std::all_of, std::any_of
 
 #include <Kodgen/CodeGen/Macro/MacroCodeGenModule.h>
 #include "Kodgen/InfoStructures/EnumInfo.h"
@@ -19,13 +20,22 @@
 #include "RefurekuGenerator/Properties/InstantiatorPropertyCodeGen.h"
 #include "RefurekuGenerator/Properties/PropertySettingsPropertyCodeGen.h"
 
+//Shared with the library so that ids computed at runtime match the ids computed by the generator
+#include <Refureku/Misc/EntityIdHash.h>
+
 namespace rfk
 {
 	class ReflectionCodeGenModule : public kodgen::MacroCodeGenModule
 	{
 		private:
-			/** Class global string hasher. */
-			inline static std::hash<std::string>		_stringHasher;
+			/** Ids of all entities generated since the generator started, hashed by their entity id. Shared by all module clones. */
+			inline static std::unordered_map<uint64, std::string>	_entityIdsByHash;
+
+			/** Descriptions of the entity id collisions detected since they were last logged. */
+			inline static std::vector<std::string>		_entityIdCollisions;
+
+			/** Mutex protecting _entityIdsByHash and _entityIdCollisions from concurrent module clones. */
+			inline static std::mutex					_entityIdsMutex;
 
 			/** Code generator for the CustomInstantiator property. */
 			InstantiatorPropertyCodeGen					_instantiatorProperty;
@@ -48,6 +58,48 @@ namespace rfk
 			*/
 			inline static std::string		getEntityId(kodgen::EntityInfo const& entity)										noexcept;
 
+			/**
+			*	@brief	Hash the id of an entity with rfk::computeEntityIdHash.
+			*			The hash is checked against the hashes of all entities generated so far, and any collision is recorded
+			*			to be reported by logEntityIdCollisions.
+			*
+			*	@param entity The target entity.
+			* 
+			*	@return The hash of the entity id.
+			*/
+			inline static uint64			computeEntityIdHash(kodgen::EntityInfo const& entity)								noexcept;
+
+			/**
+			*	@brief	Hash the canonical name of a class with rfk::computeEntityIdHash.
+			*			The hash is checked against the hashes of all entities generated so far, and any collision is recorded
+			*			to be reported by logEntityIdCollisions.
+			*
+			*	@param canonicalName The canonical name of the class.
+			* 
+			*	@return The hash of the canonical name.
+			*/
+			inline static uint64			computeCanonicalNameHash(std::string const& canonicalName)							noexcept;
+
+			/**
+			*	@brief Record a hash in the entity ids hashes, and record a collision if a different id already has the same hash.
+			*
+			*	@param hash			The hash to record.
+			*	@param id			The hashed id.
+			*	@param displayName	Name of the hashed entity, used to describe collisions.
+			*/
+			inline static void				checkEntityIdHashCollision(uint64				hash,
+																	   std::string const&	id,
+																	   std::string const&	displayName)									noexcept;
+
+			/**
+			*	@brief Log the entity id collisions detected since the last call as errors.
+			*
+			*	@param env Generation environment.
+			* 
+			*	@return true if at least one collision was logged, else false.
+			*/
+			inline static bool				logEntityIdCollisions(kodgen::MacroCodeGenEnv& env)									noexcept;
+
 			/**
 			*	@brief Convert the name of a kodgen::EEntityType to its equivalent rfk::EEntityKind name.
 			* 
@@ -179,6 +231,16 @@ namespace rfk
 			static std::string			computeClassNestedEntityId(std::string					className,
 																   kodgen::EntityInfo const&	entity)						noexcept;
 
+			/**
+			*	@brief	Compute the canonical name of a class, which is its fully qualified name without template arguments.
+			*			It is emitted as a literal in the generated code so that the ids of class nested entities don't depend on the compiler.
+			* 
+			*	@param structClass The target class.
+			* 
+			*	@return The canonical name of the class.
+			*/
+			static std::string			computeCanonicalClassName(kodgen::StructClassInfo const& structClass)				noexcept;
+
 			/**
 			*	@brief	Compute the signature of the rfk::getArchetype<> template specialization function.
 			* 
@@ -363,6 +425,18 @@ namespace rfk
 															 kodgen::MacroCodeGenEnv&		env,
 															 std::string&					inout_result)		const	noexcept;
 
+			/**
+			*	@brief	Generate the _rfk_hashCanonicalName method used by rfk::internal::typeNestedEntityId to hash the canonical name of the class.
+			*			Class template instantiations chain the canonical names of their template arguments.
+			* 
+			*	@param structClass	The target class.
+			*	@param env			Generation environment.
+			*	@param inout_result	String the generated code is appended to.
+			*/
+			static void	declareAndDefineHashCanonicalNameMethod(kodgen::StructClassInfo const&	structClass,
+																kodgen::MacroCodeGenEnv&		env,
+																std::string&					inout_result)				noexcept;
+
 			/**
 			*	TODO
 			*/
@@ -456,6 +530,18 @@ namespace rfk
 														 kodgen::MacroCodeGenEnv&	env,
 														 std::string&				inout_result)	const	noexcept;
 
+			/**
+			*	@brief	Define the rfk::EnumTable specialization of an enum, containing the name and value of all its enum values.
+			*			The table is used by rfk::enumToString and rfk::stringToEnum, and is usable in constant expressions.
+			* 
+			*	@param enum_		Enum to generate the table of.
+			*	@param env			Generation environment.
+			*	@param inout_result	String the generated code is appended to.
+			*/
+			void	defineEnumTableTemplateSpecialization(kodgen::EnumInfo const&	enum_,
+														  kodgen::MacroCodeGenEnv&	env,
+														  std::string&				inout_result)	const	noexcept;
+
 			/**
 			*	TODO
 			*/
@@ -7,7 +7,60 @@
 
 inline std::string ReflectionCodeGenModule::getEntityId(kodgen::EntityInfo const& entity) noexcept
 {
-	return std::to_string(ReflectionCodeGenModule::_stringHasher(entity.id)) + "u";
+	return std::to_string(computeEntityIdHash(entity)) + "u";
+}
+
+inline uint64 ReflectionCodeGenModule::computeEntityIdHash(kodgen::EntityInfo const& entity) noexcept
+{
+	uint64 hash = rfk::computeEntityIdHash(entity.id);
+
+	checkEntityIdHashCollision(hash, entity.id, entity.getFullName());
+
+	return hash;
+}
+
+inline uint64 ReflectionCodeGenModule::computeCanonicalNameHash(std::string const& canonicalName) noexcept
+{
+	uint64 hash = rfk::computeEntityIdHash(canonicalName);
+
+	checkEntityIdHashCollision(hash, canonicalName, "Canonical name");
+
+	return hash;
+}
+
+inline void ReflectionCodeGenModule::checkEntityIdHashCollision(uint64 hash, std::string const& id, std::string const& displayName) noexcept
+{
+	std::lock_guard<std::mutex> lock(_entityIdsMutex);
+
+	auto result = _entityIdsByHash.emplace(hash, id);
+
+	//The same entity can be hashed many times, only different ids with the same hash collide
+	if (!result.second && result.first->second != id)
+	{
+		_entityIdCollisions.emplace_back("Entity id collision: " + displayName + " (" + id + ") and " + result.first->second + " have the same id " + std::to_string(hash) + ".");
+	}
+}
+
+inline bool ReflectionCodeGenModule::logEntityIdCollisions(kodgen::MacroCodeGenEnv& env) noexcept
+{
+	std::lock_guard<std::mutex> lock(_entityIdsMutex);
+
+	if (_entityIdCollisions.empty())
+	{
+		return false;
+	}
+
+	if (env.getLogger() != nullptr)
+	{
+		for (std::string const& collision : _entityIdCollisions)
+		{
+			env.getLogger()->log(collision, kodgen::ILogger::ELogSeverity::Error);
+		}
+	}
+
+	_entityIdCollisions.clear();
+
+	return true;
 }
 
 ReflectionCodeGenModule::ReflectionCodeGenModule() noexcept:
@@ -95,6 +148,8 @@ kodgen::ETraversalBehaviour	ReflectionCodeGenModule::generateClassFooterCodeForE
 
 			declareFriendClasses(static_cast<kodgen::StructClassInfo const&>(entity), env, inout_result);
 
+			declareAndDefineHashCanonicalNameMethod(static_cast<kodgen::StructClassInfo const&>(entity), env, inout_result);
+
 			declareAndDefineRegisterChildClassMethod(static_cast<kodgen::StructClassInfo const&>(entity), env, inout_result);
 
 			if (static_cast<kodgen::StructClassInfo const&>(entity).type.isTemplateType())
@@ -170,6 +225,7 @@ kodgen::ETraversalBehaviour ReflectionCodeGenModule::generateHeaderFileFooterCod
 
 		case kodgen::EEntityType::Enum:
 			declareGetEnumTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
+			defineEnumTableTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
 
 			result = kodgen::ETraversalBehaviour::Continue; //Go to next enum
 			break;
@@ -319,6 +375,12 @@ kodgen::ETraversalBehaviour ReflectionCodeGenModule::generateSourceFileHeaderCod
 
 	checkHiddenGeneratedCodeState();
 
+	//Colliding ids would make the database reject entities at runtime, so fail the generation
+	if (logEntityIdCollisions(env))
+	{
+		return kodgen::ETraversalBehaviour::AbortWithFailure;
+	}
+
 	return result;
 }
 
@@ -326,6 +388,7 @@ void ReflectionCodeGenModule::includeHeaderFileHeaders(kodgen::MacroCodeGenEnv&
 {
 	inout_result += "#include <string>" + env.getSeparator() +
 		"#include <Refureku/Misc/CodeGenerationHelpers.h>" + env.getSeparator() +
+		"#include <Refureku/Misc/EntityIdHash.h>" + env.getSeparator() +
 		"#include <Refureku/Misc/DisableWarningMacros.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Functions/Method.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Functions/StaticMethod.h>" + env.getSeparator() +
@@ -333,6 +396,7 @@ void ReflectionCodeGenModule::includeHeaderFileHeaders(kodgen::MacroCodeGenEnv&
 		"#include <Refureku/TypeInfo/Variables/StaticField.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Archetypes/Enum.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Archetypes/EnumValue.h>" + env.getSeparator() +
+		"#include <Refureku/TypeInfo/Archetypes/EnumTable.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Variables/Variable.h>" + env.getSeparator() +											//TODO: Only if there is a variable
 		"#include <Refureku/TypeInfo/Functions/Function.h>" + env.getSeparator() +											//TODO: Only if there is a function
 		"#include <Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h>" + env.getSeparator() +							//TODO: Only when there is a template class
@@ -452,7 +516,7 @@ void ReflectionCodeGenModule::declareFriendClasses(kodgen::StructClassInfo const
 			generateFriendStatementsForNestedArcheteypesInternal(structClass.nestedStructs, thisLambda, nestingLevel);
 			generateFriendStatementsForNestedArcheteypesInternal(structClass.nestedClasses, thisLambda, nestingLevel);
 
-			//Generate rfk::getEnum friend statement if necessary
+			//Generate rfk::getEnum and rfk::EnumTable friend statements if necessary
 			if (!generatedGetEnumFriendStatement)
 			{
 				for (kodgen::NestedEnumInfo const& nestedEnum : structClass.nestedEnums)
@@ -461,6 +525,7 @@ void ReflectionCodeGenModule::declareFriendClasses(kodgen::StructClassInfo const
 					{
 						generatedGetEnumFriendStatement = true;
 						inout_result += "template <typename> friend rfk::Enum const* rfk::getEnum() noexcept;" + env.getSeparator();
+						inout_result += "template <typename> friend struct rfk::EnumTable;" + env.getSeparator();
 						break;
 					}
 				}
@@ -513,14 +578,13 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 	std::string returnType = (structClass.isClass()) ? "rfk::Class" : "rfk::Struct";
 
 	inout_result += returnType + " const& " + structClass.type.getCanonicalName() + "::staticGetArchetype() noexcept {" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() +
-		"static " + returnType + " type(\"" + structClass.name + "\", " +
+		"static rfk::internal::InitializationGuard initGuard;" + env.getSeparator() +
+		"static " + returnType + " type(rfk::EntityName::fromLiteral(\"" + structClass.name + "\"), " +
 		getEntityId(structClass) + ", "
 		"sizeof(" + structClass.name + "), " +
 		std::to_string(structClass.isClass()) +
 		");" + env.getSeparator() +
-		"if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+		"if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
 	fillEntityProperties(structClass, env, "type.", inout_result);
@@ -532,6 +596,8 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 	fillClassMethods(structClass, env, "type.", inout_result);
 	fillClassNestedArchetypes(structClass, env, "type.", inout_result);
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End of the initialization if statement
 	inout_result += "}" + env.getSeparator();
 
@@ -576,7 +642,34 @@ std::string ReflectionCodeGenModule::computeClassTemplateEntityId(kodgen::Struct
 
 std::string ReflectionCodeGenModule::computeClassNestedEntityId(std::string className, kodgen::EntityInfo const& entity) noexcept
 {
-	return "std::hash<std::string>()(std::string(\"" + entity.id + "\") + rfk::internal::getTypename<" + std::move(className) + ">())";
+	//The id is the hash of the entity id concatenated with the class canonical name, computed at compile time
+	return "rfk::internal::typeNestedEntityId<" + std::move(className) + ", " + std::to_string(computeEntityIdHash(entity)) + "u>";
+}
+
+std::string ReflectionCodeGenModule::computeCanonicalClassName(kodgen::StructClassInfo const& structClass) noexcept
+{
+	std::string canonicalName = structClass.getFullName();
+
+	//Remove the template arguments list of class templates, they are appended by the generated code
+	if (!canonicalName.empty() && canonicalName.back() == '>')
+	{
+		int depth = 0;
+
+		for (std::size_t i = canonicalName.size(); i-- > 0u;)
+		{
+			if (canonicalName[i] == '>')
+			{
+				depth++;
+			}
+			else if (canonicalName[i] == '<' && --depth == 0)
+			{
+				canonicalName.resize(i);
+				break;
+			}
+		}
+	}
+
+	return canonicalName;
 }
 
 std::string ReflectionCodeGenModule::computeGetArchetypeFunctionSignature(kodgen::StructClassInfo const& structClass) noexcept
@@ -686,13 +779,13 @@ void ReflectionCodeGenModule::fillEntityProperties(kodgen::EntityInfo const& ent
 void ReflectionCodeGenModule::setClassDefaultInstantiators(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env,
 														  std::string const& generatedClassVarName, std::string& inout_result) noexcept
 {
-	inout_result += "static rfk::StaticMethod defaultSharedInstantiator(\"\", 0u, rfk::getType<rfk::SharedPtr<" + structClass.name +">>(),"
+	inout_result += "static rfk::StaticMethod defaultSharedInstantiator(rfk::EntityName::fromLiteral(\"\"), 0u, rfk::getType<rfk::SharedPtr<" + structClass.name +">>(),"
 		"new rfk::NonMemberFunction<rfk::SharedPtr<" + structClass.name + ">()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<" + structClass.name + ">),"
 		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
 
 	inout_result += generatedClassVarName + "addSharedInstantiator(defaultSharedInstantiator);" + env.getSeparator();
 
-	inout_result += "static rfk::StaticMethod defaultUniqueInstantiator(\"\", 0u, rfk::getType<rfk::UniquePtr<" + structClass.name +">>(),"
+	inout_result += "static rfk::StaticMethod defaultUniqueInstantiator(rfk::EntityName::fromLiteral(\"\"), 0u, rfk::getType<rfk::UniquePtr<" + structClass.name +">>(),"
 		"new rfk::NonMemberFunction<rfk::UniquePtr<" + structClass.name + ">()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<" + structClass.name + ">),"
 		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
 
@@ -739,8 +832,8 @@ void ReflectionCodeGenModule::fillClassMethods(kodgen::StructClassInfo const& st
 		{
 			staticMethodsCount++;
 
-			inout_result += "staticMethod = " + generatedEntityVarName + "addStaticMethod(\"" + method.name + "\", " +
-				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : std::to_string(_stringHasher(method.id)) + "u") + ", "
+			inout_result += "staticMethod = " + generatedEntityVarName + "addStaticMethod(rfk::EntityName::fromLiteral(\"" + method.name + "\"), " +
+				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : getEntityId(method)) + ", "
 				"rfk::getType<" + method.returnType.getName() + ">(), "
 				"new rfk::NonMemberFunction<" + method.getPrototype(true) + ">(& " + structClass.name + "::" + method.name + "), "
 				"static_cast<rfk::EMethodFlags>(" + std::to_string(computeRefurekuMethodFlags(method)) + "));" + env.getSeparator();
@@ -751,8 +844,8 @@ void ReflectionCodeGenModule::fillClassMethods(kodgen::StructClassInfo const& st
 		{
 			methodsCount++;
 
-			inout_result += "method = " + generatedEntityVarName + "addMethod(\"" + method.name + "\", " +
-				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : std::to_string(_stringHasher(method.id)) + "u") + ", "
+			inout_result += "method = " + generatedEntityVarName + "addMethod(rfk::EntityName::fromLiteral(\"" + method.name + "\"), " +
+				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : getEntityId(method)) + ", "
 				"rfk::getType<" + method.returnType.getName() + ">(), "
 				"new rfk::MemberFunction<" + structClass.name + ", " + method.getPrototype(true) + ">(static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")), "
 				"static_cast<rfk::EMethodFlags>(" + std::to_string(computeRefurekuMethodFlags(method)) + "));" + env.getSeparator();
@@ -768,7 +861,7 @@ void ReflectionCodeGenModule::fillClassMethods(kodgen::StructClassInfo const& st
 
 			for (kodgen::FunctionParamInfo const& param : method.parameters)
 			{
-				generatedCode += currentMethodVariable + "->addParameter(\"" + param.name + "\", 0u, rfk::getType<" + param.type.getName() + ">());" + env.getSeparator();	//TODO: Build Id for parameters
+				generatedCode += currentMethodVariable + "->addParameter(rfk::EntityName::fromLiteral(\"" + param.name + "\"), 0u, rfk::getType<" + param.type.getName() + ">());" + env.getSeparator();	//TODO: Build Id for parameters
 			}
 
 			//Write generated parameters string to file
@@ -871,6 +964,52 @@ void ReflectionCodeGenModule::defineGetArchetypeTemplateSpecialization(kodgen::S
 		"return &" + structClass.getFullName() + "::staticGetArchetype(); }" + env.getSeparator() + env.getSeparator();
 }
 
+void ReflectionCodeGenModule::declareAndDefineHashCanonicalNameMethod(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
+{
+	std::string canonicalName = computeCanonicalClassName(structClass);
+
+	//Only used to detect collisions, the hash is computed again from the literal in the generated code
+	computeCanonicalNameHash(canonicalName);
+
+	inout_result += "private: static constexpr rfk::uint64 _rfk_hashCanonicalName(rfk::uint64 seed, " + structClass.name + " const*) noexcept {" + env.getSeparator();
+
+	if (structClass.type.isTemplateType())
+	{
+		std::vector<kodgen::TemplateParamInfo> const& templateParameters = structClass.type.getTemplateParameters();
+
+		bool hasTemplateTemplateParameter = std::any_of(templateParameters.cbegin(), templateParameters.cend(),
+														[](kodgen::TemplateParamInfo const& param) { return param.kind == kodgen::ETemplateParameterKind::TemplateTemplateParameter; });
+
+		if (hasTemplateTemplateParameter)
+		{
+			//Template template arguments have no name at compile time, so fall back on the compiler generated type name
+			inout_result += "return rfk::internal::computeTypenameEntityIdHash<" + structClass.name + ">(seed); }" + env.getSeparator() + env.getSeparator();
+			return;
+		}
+
+		inout_result += "seed = rfk::computeEntityIdHash(\"" + canonicalName + "<\", seed);" + env.getSeparator();
+
+		for (std::size_t i = 0; i < templateParameters.size(); i++)
+		{
+			if (i != 0u)
+			{
+				inout_result += "seed = rfk::computeEntityIdHash(\",\", seed);" + env.getSeparator();
+			}
+
+			inout_result += (templateParameters[i].kind == kodgen::ETemplateParameterKind::TypeTemplateParameter) ?
+				"seed = rfk::internal::CodeGenerationHelpers::hashCanonicalTypename<" + templateParameters[i].name + ">(seed);" :
+				"seed = rfk::internal::CodeGenerationHelpers::hashCanonicalValue<" + templateParameters[i].name + ">(seed);";
+			inout_result += env.getSeparator();
+		}
+
+		inout_result += "return rfk::computeEntityIdHash(\">\", seed); }" + env.getSeparator() + env.getSeparator();
+	}
+	else
+	{
+		inout_result += "return rfk::computeEntityIdHash(\"" + canonicalName + "\", seed); }" + env.getSeparator() + env.getSeparator();
+	}
+}
+
 void ReflectionCodeGenModule::declareAndDefineRegisterChildClassMethod(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	bool isGeneratingHiddenCode = _isGeneratingHiddenCode;
@@ -920,7 +1059,7 @@ void ReflectionCodeGenModule::declareAndDefineRegisterChildClassMethod(kodgen::S
 			{
 				staticFieldsCount++;
 
-				inout_result += "staticField = childClass.addStaticField(\"" + field.name + "\", " +
+				inout_result += "staticField = childClass.addStaticField(rfk::EntityName::fromLiteral(\"" + field.name + "\"), " +
 					(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, field) : computeClassNestedEntityId("ChildClass", field)) + ", " +
 					"rfk::getType<" + field.type.getName() + ">(), "
 					"static_cast<rfk::EFieldFlags>(" + std::to_string(computeRefurekuFieldFlags(field)) + "), "
@@ -933,7 +1072,7 @@ void ReflectionCodeGenModule::declareAndDefineRegisterChildClassMethod(kodgen::S
 			{
 				fieldsCount++;
 
-				inout_result += "field = childClass.addField(\"" + field.name + "\", " +
+				inout_result += "field = childClass.addField(rfk::EntityName::fromLiteral(\"" + field.name + "\"), " +
 					(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, field) : computeClassNestedEntityId("ChildClass", field)) + ", " +
 					"rfk::getType<" + field.type.getName() + ">(), "
 					"static_cast<rfk::EFieldFlags>(" + std::to_string(computeRefurekuFieldFlags(field)) + "), "
@@ -1008,16 +1147,15 @@ void ReflectionCodeGenModule::declareAndDefineClassRegistererVariable(kodgen::St
 void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMethod(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	inout_result += "public: static rfk::ClassTemplateInstantiation const& staticGetArchetype() noexcept {" + env.getSeparator();
-	inout_result += "static bool initialized = false;" + env.getSeparator();
-	inout_result += "static rfk::ClassTemplateInstantiation type(\"" + structClass.type.getName(false, true) + "\"," +
+	inout_result += "static rfk::internal::InitializationGuard initGuard;" + env.getSeparator();
+	inout_result += "static rfk::ClassTemplateInstantiation type(rfk::EntityName::fromLiteral(\"" + structClass.type.getName(false, true) + "\")," +
 		computeClassTemplateEntityId(structClass, structClass) + ", " +
 		"sizeof(" + structClass.getFullName() + "), " + 
 		std::to_string(structClass.isClass()) + ", "
 		"*rfk::getArchetype<::" + structClass.type.getName() + ">());" + env.getSeparator();
 
 	//Init content
-	inout_result += "if (!initialized) {" + env.getSeparator();
-	inout_result += "initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
 	fillClassTemplateArguments(structClass, "type.", env, inout_result);
@@ -1030,6 +1168,8 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMet
 	fillClassMethods(structClass, env, "type.", inout_result);
 	fillClassNestedArchetypes(structClass, env, "type.", inout_result);
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End init
 	inout_result += "}" + env.getSeparator();
 
@@ -1096,15 +1236,14 @@ void ReflectionCodeGenModule::defineClassTemplateGetArchetypeTemplateSpecializat
 	assert(structClass.type.isTemplateType());
 
 	inout_result += "template <> " + env.getExportSymbolMacro() + " rfk::Archetype const* rfk::getArchetype<" + structClass.type.getName() + ">() noexcept {" + env.getSeparator();
-	inout_result += "static bool initialized = false;" + env.getSeparator();
-	inout_result += "static rfk::ClassTemplate type(\"" + structClass.type.getName(false, true) + "\", " +
-		std::to_string(_stringHasher(structClass.id)) + "u, " +
+	inout_result += "static rfk::internal::InitializationGuard initGuard;" + env.getSeparator();
+	inout_result += "static rfk::ClassTemplate type(rfk::EntityName::fromLiteral(\"" + structClass.type.getName(false, true) + "\"), " +
+		getEntityId(structClass) + ", " +
 		std::to_string(structClass.isClass()) + 
 		");" + env.getSeparator();
 
 	//Init class template content
-	inout_result += "if (!initialized) {" + env.getSeparator();
-	inout_result += "initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	fillEntityProperties(structClass, env, "type.", inout_result);
 
@@ -1112,6 +1251,8 @@ void ReflectionCodeGenModule::defineClassTemplateGetArchetypeTemplateSpecializat
 	//Likewise, the parent type can depend on the template params which are not accessible from this method, so omit them
 	fillClassTemplateParameters(structClass, "type.", env, inout_result);
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End init if
 	inout_result += "}";
 
@@ -1316,6 +1457,22 @@ void ReflectionCodeGenModule::declareGetEnumTemplateSpecialization(kodgen::EnumI
 	inout_result += "template <> " + env.getExportSymbolMacro() + " rfk::Enum const* rfk::getEnum<" + enum_.type.getCanonicalName() + ">() noexcept;" + env.getSeparator();
 }
 
+void ReflectionCodeGenModule::defineEnumTableTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
+{
+	std::string typeName = enum_.type.getCanonicalName();
+
+	inout_result += "template <> struct rfk::EnumTable<" + typeName + "> { static constexpr std::array<rfk::EnumTableEntry<" + typeName + ">, " +
+		std::to_string(enum_.enumValues.size()) + "> entries{{";
+
+	//Entries are emitted in declaration order, rfk::internal::EnumTableHelper sorts them at compile time
+	for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		inout_result += "{\"" + enumValue.name + "\", static_cast<" + typeName + ">(" + std::to_string(enumValue.value) + ")},";
+	}
+
+	inout_result += "}}; };" + env.getSeparator();
+}
+
 void ReflectionCodeGenModule::defineGetEnumTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	//Don't generate template specialization code on non-public enums
@@ -1329,14 +1486,13 @@ void ReflectionCodeGenModule::defineGetEnumTemplateSpecialization(kodgen::EnumIn
 void ReflectionCodeGenModule::defineGetEnumContent(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	inout_result += "{" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() +
-		"static rfk::Enum type(\"" + enum_.name + "\", " +
+		"static rfk::internal::InitializationGuard initGuard;" + env.getSeparator() +
+		"static rfk::Enum type(rfk::EntityName::fromLiteral(\"" + enum_.name + "\"), " +
 		getEntityId(enum_) + ", "
 		"rfk::getArchetype<" + enum_.underlyingType.getCanonicalName() + ">());" + env.getSeparator();
 
 	//Initialize the enum metadata
-	inout_result += "if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	fillEntityProperties(enum_, env, "type.", inout_result);
 
@@ -1347,13 +1503,15 @@ void ReflectionCodeGenModule::defineGetEnumContent(kodgen::EnumInfo const& enum_
 
 		for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
 		{
-			inout_result += "enumValue = type.addEnumValue(\"" + enumValue.name + "\", " + getEntityId(enumValue) + ", " + std::to_string(enumValue.value) + ");" + env.getSeparator();
+			inout_result += "enumValue = type.addEnumValue(rfk::EntityName::fromLiteral(\"" + enumValue.name + "\"), " + getEntityId(enumValue) + ", " + std::to_string(enumValue.value) + ");" + env.getSeparator();
 
 			//Fill enum value properties
 			fillEntityProperties(enumValue, env, "enumValue->", inout_result);
 		}
 	}
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End initialization if
 	inout_result += "}" + env.getSeparator();
 
@@ -1383,8 +1541,8 @@ void ReflectionCodeGenModule::defineGetVariableFunction(kodgen::VariableInfo con
 	std::string fullName = variable.getFullName();
 
 	inout_result += "template <> rfk::Variable const* rfk::getVariable<&" + variable.getFullName() + ">() noexcept {" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() + 
-		"static rfk::Variable variable(\"" + variable.name + "\", " +
+		"static rfk::internal::InitializationGuard initGuard;" + env.getSeparator() + 
+		"static rfk::Variable variable(rfk::EntityName::fromLiteral(\"" + variable.name + "\"), " +
 		getEntityId(variable) + ", "
 		"rfk::getType<decltype(" + fullName + ")>(), "
 		"&" + fullName + ", "
@@ -1392,11 +1550,12 @@ void ReflectionCodeGenModule::defineGetVariableFunction(kodgen::VariableInfo con
 		");" + env.getSeparator();
 
 	//Initialize variable metadata
-	inout_result += "if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	fillEntityProperties(variable, env, "variable.", inout_result);
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End initialization if
 	inout_result += "}";
 
@@ -1436,8 +1595,8 @@ void ReflectionCodeGenModule::declareGetFunctionFunction(kodgen::FunctionInfo co
 void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo const& function, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	inout_result += "template <> rfk::Function const* rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>() noexcept {" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() + 
-		"static rfk::Function function(\"" + function.name + "\", " +
+		"static rfk::internal::InitializationGuard initGuard;" + env.getSeparator() + 
+		"static rfk::Function function(rfk::EntityName::fromLiteral(\"" + function.name + "\"), " +
 		getEntityId(function) + ", "
 		"rfk::getType<" + function.returnType.getCanonicalName() + ">(), "
 		"new rfk::NonMemberFunction<" + function.getPrototype(true) + ">(&" + function.getFullName() + "), "
@@ -1445,8 +1604,7 @@ void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo con
 		");" + env.getSeparator();
 
 	//Initialize variable metadata
-	inout_result += "if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	fillEntityProperties(function, env, "function.", inout_result);
 
@@ -1457,12 +1615,14 @@ void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo con
 
 		for (kodgen::FunctionParamInfo const& param : function.parameters)
 		{
-			inout_result += "function.addParameter(\"" + param.name + "\", 0u, rfk::getType<" + param.type.getName() + ">());" + env.getSeparator();	//TODO: Build an id for the parameter
+			inout_result += "function.addParameter(rfk::EntityName::fromLiteral(\"" + param.name + "\"), 0u, rfk::getType<" + param.type.getName() + ">());" + env.getSeparator();	//TODO: Build an id for the parameter
 		}
 
 		inout_result += ";" + env.getSeparator();
 	}
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End initialization if
 	inout_result += "}";
 
@@ -1503,13 +1663,12 @@ std::string ReflectionCodeGenModule::computeFunctionPtrType(kodgen::FunctionInfo
 void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentFunction(kodgen::NamespaceInfo const& namespace_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	inout_result += env.getInternalSymbolMacro() + " static rfk::NamespaceFragment const& " + computeGetNamespaceFragmentFunctionName(namespace_, env.getFileParsingResult()->parsedFile) + "() noexcept {" + env.getSeparator() +
-		"static rfk::NamespaceFragment fragment(\"" + namespace_.name + "\", " + getEntityId(namespace_) + ");" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator();
+		"static rfk::NamespaceFragment fragment(rfk::EntityName::fromLiteral(\"" + namespace_.name + "\"), " + getEntityId(namespace_) + ");" + env.getSeparator() +
+		"static rfk::internal::InitializationGuard initGuard;" + env.getSeparator();
 
 
 	//Initialize namespace metadata
-	inout_result += "if (!initialized) {" + env.getSeparator() +
-		"initialized = true;" + env.getSeparator();
+	inout_result += "if (initGuard.tryBeginInitialization()) {" + env.getSeparator();
 
 	fillEntityProperties(namespace_, env, "fragment.", inout_result);
 
@@ -1559,6 +1718,8 @@ void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentFunction(kodge
 		}
 	}
 
+	inout_result += "initGuard.endInitialization();" + env.getSeparator();
+
 	//End initialization if
 	inout_result += "}" + env.getSeparator();
 
@@ -1605,10 +1766,10 @@ void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentAndRegistererR
 
 std::string ReflectionCodeGenModule::computeGetNamespaceFragmentFunctionName(kodgen::NamespaceInfo const& namespace_, fs::path const& sourceFile) noexcept
 {
-	return "getNamespaceFragment_" + getEntityId(namespace_) + "_" + std::to_string(_stringHasher(sourceFile.string()));
+	return "getNamespaceFragment_" + getEntityId(namespace_) + "_" + std::to_string(rfk::computeEntityIdHash(sourceFile.string()));
 }
 
 std::string ReflectionCodeGenModule::computeNamespaceFragmentRegistererName(kodgen::NamespaceInfo const& namespace_, fs::path const& sourceFile) noexcept
 {
-	return "namespaceFragmentRegisterer_" + getEntityId(namespace_) + "_" + std::to_string(_stringHasher(sourceFile.string()));
+	return "namespaceFragmentRegisterer_" + getEntityId(namespace_) + "_" + std::to_string(rfk::computeEntityIdHash(sourceFile.string()));
 }
\ No newline at end of file
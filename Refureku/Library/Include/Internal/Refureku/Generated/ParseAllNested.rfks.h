@@ -16,31 +16,31 @@ rfk::EEntityKind kodgen::ParseAllNested::getTargetEntityKind() const noexcept {
 static_assert(std::is_base_of_v<rfk::Property, kodgen::ParseAllNested>, "[Refureku] Can't attach rfk::PropertySettings property to kodgen::ParseAllNested as it doesn't inherit from rfk::Property.");
 namespace rfk::generated { 
  static rfk::NamespaceFragment const& getNamespaceFragment_5603044350098704190u_5959650475308226396() noexcept {
-static rfk::NamespaceFragment fragment("kodgen", 5603044350098704190u);
-static bool initialized = false;
-if (!initialized) {
-initialized = true;
+static rfk::NamespaceFragment fragment(rfk::EntityName::fromLiteral("kodgen"), 5603044350098704190u);
+static rfk::internal::InitializationGuard initGuard;
+if (initGuard.tryBeginInitialization()) {
 fragment.setNestedEntitiesCapacity(1u);
 fragment.addNestedEntity(*rfk::getArchetype<kodgen::ParseAllNested>());
+initGuard.endInitialization();
 }
 return fragment; }
 static rfk::NamespaceFragmentRegisterer const namespaceFragmentRegisterer_5603044350098704190u_5959650475308226396(rfk::generated::getNamespaceFragment_5603044350098704190u_5959650475308226396());
  }
 rfk::Class const& kodgen::ParseAllNested::staticGetArchetype() noexcept {
-static bool initialized = false;
-static rfk::Class type("ParseAllNested", 1518429735798145968u, sizeof(ParseAllNested), 1);
-if (!initialized) {
-initialized = true;
+static rfk::internal::InitializationGuard initGuard;
+static rfk::Class type(rfk::EntityName::fromLiteral("ParseAllNested"), 1518429735798145968u, sizeof(ParseAllNested), 1);
+if (initGuard.tryBeginInitialization()) {
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_1518429735798145968u_0{rfk::EEntityKind::Namespace | rfk::EEntityKind::Class | rfk::EEntityKind::Struct};type.addProperty(property_1518429735798145968u_0);
 type.setDirectParentsCapacity(1);
 type.addDirectParent(rfk::getArchetype<rfk::Property>(), static_cast<rfk::EAccessSpecifier>(1));
 ParseAllNested::_rfk_registerChildClass<ParseAllNested>(type);
-static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::SharedPtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
+static rfk::StaticMethod defaultSharedInstantiator(rfk::EntityName::fromLiteral(""), 0u, rfk::getType<rfk::SharedPtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::SharedPtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
 type.addSharedInstantiator(defaultSharedInstantiator);
-static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::UniquePtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
+static rfk::StaticMethod defaultUniqueInstantiator(rfk::EntityName::fromLiteral(""), 0u, rfk::getType<rfk::UniquePtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::UniquePtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
+initGuard.endInitialization();
 }
 return type; }
 
@@ -16,31 +16,31 @@ rfk::EEntityKind rfk::PropertySettings::getTargetEntityKind() const noexcept { r
 static_assert(std::is_base_of_v<rfk::Property, rfk::PropertySettings>, "[Refureku] Can't attach rfk::PropertySettings property to rfk::PropertySettings as it doesn't inherit from rfk::Property.");
 namespace rfk::generated { 
  static rfk::NamespaceFragment const& getNamespaceFragment_6202377051882013391u_15963945972659803745() noexcept {
-static rfk::NamespaceFragment fragment("rfk", 6202377051882013391u);
-static bool initialized = false;
-if (!initialized) {
-initialized = true;
+static rfk::NamespaceFragment fragment(rfk::EntityName::fromLiteral("rfk"), 6202377051882013391u);
+static rfk::internal::InitializationGuard initGuard;
+if (initGuard.tryBeginInitialization()) {
 fragment.setNestedEntitiesCapacity(1u);
 fragment.addNestedEntity(*rfk::getArchetype<rfk::PropertySettings>());
+initGuard.endInitialization();
 }
 return fragment; }
 static rfk::NamespaceFragmentRegisterer const namespaceFragmentRegisterer_6202377051882013391u_15963945972659803745(rfk::generated::getNamespaceFragment_6202377051882013391u_15963945972659803745());
  }
 rfk::Class const& rfk::PropertySettings::staticGetArchetype() noexcept {
-static bool initialized = false;
-static rfk::Class type("PropertySettings", 9343641787758265814u, sizeof(PropertySettings), 1);
-if (!initialized) {
-initialized = true;
+static rfk::internal::InitializationGuard initGuard;
+static rfk::Class type(rfk::EntityName::fromLiteral("PropertySettings"), 9343641787758265814u, sizeof(PropertySettings), 1);
+if (initGuard.tryBeginInitialization()) {
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_9343641787758265814u_0{rfk::EEntityKind::Struct | rfk::EEntityKind::Class};type.addProperty(property_9343641787758265814u_0);
 type.setDirectParentsCapacity(1);
 type.addDirectParent(rfk::getArchetype<rfk::Property>(), static_cast<rfk::EAccessSpecifier>(1));
 PropertySettings::_rfk_registerChildClass<PropertySettings>(type);
-static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::SharedPtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
+static rfk::StaticMethod defaultSharedInstantiator(rfk::EntityName::fromLiteral(""), 0u, rfk::getType<rfk::SharedPtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::SharedPtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
 type.addSharedInstantiator(defaultSharedInstantiator);
-static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::UniquePtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
+static rfk::StaticMethod defaultUniqueInstantiator(rfk::EntityName::fromLiteral(""), 0u, rfk::getType<rfk::UniquePtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::UniquePtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
+initGuard.endInitialization();
 }
 return type; }
 
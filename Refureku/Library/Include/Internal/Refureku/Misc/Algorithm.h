@@ -8,8 +8,12 @@
 #pragma once
 
 #include <type_traits>
+#include <string_view>
+#include <utility>	//std::move
 
 #include "Refureku/TypeInfo/Entity/EntityImpl.h"
+#include "Refureku/TypeInfo/Entity/EntityIdIndex.h"
+#include "Refureku/TypeInfo/Entity/EntityNameIndex.h"
 #include "Refureku/Containers/Vector.h"
 #include "Refureku/Misc/Visitor.h"
 #include "Refureku/Misc/Predicate.h"
@@ -154,15 +158,68 @@ namespace rfk
 																					   Visitor				visitor);
 
 			/**
-			*	@brief Find an entity by Id in a container containing Entity* or derivate.
+			*	@brief Retrieve an entity with the given name in an entity name index.
 			* 
-			*	@param container	Container containing entity pointers.
-			*	@param id			Id to look for.
+			*	@param index	Index containing the entities.
+			*	@param name		Name of the entity to look for.
+			* 
+			*	@return The first entity that has the given name in the index if any, else nullptr.
+			*/
+			template <typename T, bool AllowDuplicateNames>
+			RFK_NODISCARD static T const*							getEntityByName(EntityNameIndex<T, AllowDuplicateNames> const&	index,
+																					std::string_view								name)		noexcept;
+
+			/**
+			*	@brief Get the first entity of a given name matching a predicate in an entity name index.
+			* 
+			*	@param index		Index containing the entities.
+			*	@param name			Name of the entity to look for.
+			*	@param predicate	Predicate that defines if an entity matches or not. Prototype must be bool(T const&).
+			* 
+			*	@return A pointer to the first matching entity if any was found, else nullptr.
+			*/
+			template <typename T, bool AllowDuplicateNames, typename Predicate>
+			RFK_NODISCARD static T const*							getEntityByNameAndPredicate(EntityNameIndex<T, AllowDuplicateNames> const&	index,
+																								std::string_view								name,
+																								Predicate										predicate);
+
+			/**
+			*	@brief Get all entities of a given name matching a predicate in an entity name index.
+			* 
+			*	@param index		Index containing the entities.
+			*	@param name			Name of the entities to look for.
+			*	@param predicate	Predicate that defines if an entity matches or not. Prototype must be bool(T const&).
+			* 
+			*	@return A vector containing all entities that match the given name and predicate.
+			*/
+			template <typename T, bool AllowDuplicateNames, typename Predicate>
+			RFK_NODISCARD static Vector<T const*>					getEntitiesByNameAndPredicate(EntityNameIndex<T, AllowDuplicateNames> const&	index,
+																								  std::string_view								name,
+																								  Predicate										predicate);
+
+			/**
+			*	@brief Iterate over all entities named with the given name in an entity name index.
+			* 
+			*	@param index	Index containing the entities.
+			*	@param name		Name of the entities to iterate on.
+			*	@param visitor	Visitor to call on each entity.
+			* 
+			*	@return The last visitor result before exiting the loop.
+			*/
+			template <typename T, bool AllowDuplicateNames, typename Visitor>
+			static bool												foreachEntityNamed(EntityNameIndex<T, AllowDuplicateNames> const&	index,
+																					   std::string_view									name,
+																					   Visitor											visitor);
+
+			/**
+			*	@brief Find an entity by Id in a flat entity id index.
+			* 
+			*	@param index	Index containing the entities.
+			*	@param id		Id to look for.
 			* 
 			*	@return The entity with the provided id if any, else nullptr
 			*/
-			template <typename ContainerType>
-			RFK_NODISCARD static typename ContainerType::value_type	getEntityPtrById(ContainerType const&	container,
+			RFK_NODISCARD static inline Entity const*				getEntityPtrById(EntityIdIndex const&	index,
 																					 std::size_t			id)							noexcept;
 
 			/**
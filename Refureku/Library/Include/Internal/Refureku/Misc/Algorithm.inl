@@ -152,11 +152,15 @@ auto Algorithm::getEntityByName(ContainerType const& container, char const* name
 		return nullptr;
 	}
 
-	Entity::EntityImpl	searchedImpl(name, 0u);
-	Entity				searchedEntity(&searchedImpl);
-
-	if constexpr (std::is_pointer_v<typename ContainerType::value_type>)
+	if constexpr (IsEntityNameIndex<ContainerType>::value)
 	{
+		return Algorithm::getEntityByName(container, std::string_view(name));
+	}
+	else if constexpr (std::is_pointer_v<typename ContainerType::value_type>)
+	{
+		Entity::EntityImpl	searchedImpl(name, 0u);
+		Entity				searchedEntity(&searchedImpl);
+
 		typename ContainerType::const_iterator it = container.find(reinterpret_cast<typename ContainerType::value_type>(&searchedEntity));
 
 		//When deleted, the Entity will try to delete the implementation pointer.
@@ -168,6 +172,9 @@ auto Algorithm::getEntityByName(ContainerType const& container, char const* name
 	}
 	else
 	{
+		Entity::EntityImpl	searchedImpl(name, 0u);
+		Entity				searchedEntity(&searchedImpl);
+
 		typename ContainerType::const_iterator it = container.find(reinterpret_cast<typename ContainerType::value_type const&>(searchedEntity));
 
 		//When deleted, the Entity will try to delete the implementation pointer.
@@ -182,9 +189,16 @@ auto Algorithm::getEntityByName(ContainerType const& container, char const* name
 template <typename ContainerType, typename Predicate>
 auto Algorithm::getEntityByNameAndPredicate(ContainerType const& container, char const* name, Predicate predicate) -> typename std::remove_pointer_t<typename ContainerType::value_type> const*
 {
-	auto result = Algorithm::getEntityByName(container, name);
+	if constexpr (IsEntityNameIndex<ContainerType>::value)
+	{
+		return (name != nullptr) ? Algorithm::getEntityByNameAndPredicate(container, std::string_view(name), std::move(predicate)) : nullptr;
+	}
+	else
+	{
+		auto result = Algorithm::getEntityByName(container, name);
 
-	return (result != nullptr && predicate(*result)) ? result : nullptr;
+		return (result != nullptr && predicate(*result)) ? result : nullptr;
+	}
 }
 
 template <typename ContainerType, typename Predicate>
@@ -197,31 +211,74 @@ auto Algorithm::getEntitiesByNameAndPredicate(ContainerType const& container, ch
 		return ResultVector();
 	}
 
-	//When calling this method, we expect to have at least 2 results, so preallocate memory to avoid reallocations.
-	ResultVector result(2);
+	if constexpr (IsEntityNameIndex<ContainerType>::value)
+	{
+		return Algorithm::getEntitiesByNameAndPredicate(container, std::string_view(name), std::move(predicate));
+	}
+	else
+	{
+		//When calling this method, we expect to have at least 2 results, so preallocate memory to avoid reallocations.
+		ResultVector result(2);
 
-	Entity::EntityImpl	searchedImpl(name, 0u);
-	Entity				searchedEntity(&searchedImpl);
+		Entity::EntityImpl	searchedImpl(name, 0u);
+		Entity				searchedEntity(&searchedImpl);
 
-	if constexpr (std::is_pointer_v<typename ContainerType::value_type>)
-	{
-		auto range = container.equal_range(static_cast<typename ContainerType::value_type>(&searchedEntity));
+		if constexpr (std::is_pointer_v<typename ContainerType::value_type>)
+		{
+			auto range = container.equal_range(static_cast<typename ContainerType::value_type>(&searchedEntity));
 
-		//When deleted, the Entity will try to delete the implementation pointer.
-		//As the implementation was not dynamically newed (to save perf), it crashes here.
-		//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
-		searchedEntity._pimpl.uncheckedSet(nullptr);
+			//When deleted, the Entity will try to delete the implementation pointer.
+			//As the implementation was not dynamically newed (to save perf), it crashes here.
+			//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
+			searchedEntity._pimpl.uncheckedSet(nullptr);
 
-		for (auto it = range.first; it != range.second; it++)
+			for (auto it = range.first; it != range.second; it++)
+			{
+				if (predicate(**it))
+				{
+					result.push_back(*it);
+				}
+			}
+		}
+		else
 		{
-			if (predicate(**it))
+			auto range = container.equal_range(static_cast<typename ContainerType::value_type const&>(searchedEntity));
+
+			//When deleted, the Entity will try to delete the implementation pointer.
+			//As the implementation was not dynamically newed (to save perf), it crashes here.
+			//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
+			searchedEntity._pimpl.uncheckedSet(nullptr);
+
+			for (auto it = range.first; it != range.second; it++)
 			{
-				result.push_back(*it);
+				if (predicate(*it))
+				{
+					result.push_back(&*it);
+				}
 			}
 		}
+
+		return result;
+	}
+}
+
+template <typename ContainerType, typename Visitor>
+bool Algorithm::foreachEntityNamed(ContainerType const& container, char const* name, Visitor visitor)
+{
+	if (name == nullptr)
+	{
+		return false;
+	}
+
+	if constexpr (IsEntityNameIndex<ContainerType>::value)
+	{
+		return Algorithm::foreachEntityNamed(container, std::string_view(name), std::move(visitor));
 	}
 	else
 	{
+		Entity::EntityImpl	searchedImpl(name, 0u);
+		Entity				searchedEntity(&searchedImpl);
+
 		auto range = container.equal_range(static_cast<typename ContainerType::value_type const&>(searchedEntity));
 
 		//When deleted, the Entity will try to delete the implementation pointer.
@@ -231,59 +288,70 @@ auto Algorithm::getEntitiesByNameAndPredicate(ContainerType const& container, ch
 
 		for (auto it = range.first; it != range.second; it++)
 		{
-			if (predicate(*it))
+			if (!visitor(*it))
 			{
-				result.push_back(&*it);
+				return false;
 			}
 		}
-	}
 
-	return result;
+		return true;
+	}
 }
 
-template <typename ContainerType, typename Visitor>
-bool Algorithm::foreachEntityNamed(ContainerType const& container, char const* name, Visitor visitor)
+template <typename T, bool AllowDuplicateNames>
+T const* Algorithm::getEntityByName(EntityNameIndex<T, AllowDuplicateNames> const& index, std::string_view name) noexcept
 {
-	if (name == nullptr)
-	{
-		return false;
-	}
+	return index.find(name);
+}
 
-	Entity::EntityImpl	searchedImpl(name, 0u);
-	Entity				searchedEntity(&searchedImpl);
+template <typename T, bool AllowDuplicateNames, typename Predicate>
+T const* Algorithm::getEntityByNameAndPredicate(EntityNameIndex<T, AllowDuplicateNames> const& index, std::string_view name, Predicate predicate)
+{
+	T const* result = nullptr;
 
-	auto range = container.equal_range(static_cast<typename ContainerType::value_type const&>(searchedEntity));
+	index.foreachNamed(name, [&result, &predicate](T const& entity)
+					   {
+						   if (predicate(entity))
+						   {
+							   result = &entity;
 
-	//When deleted, the Entity will try to delete the implementation pointer.
-	//As the implementation was not dynamically newed (to save perf), it crashes here.
-	//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
-	searchedEntity._pimpl.uncheckedSet(nullptr);
+							   return false;
+						   }
 
-	for (auto it = range.first; it != range.second; it++)
-	{
-		if (!visitor(*it))
-		{
-			return false;
-		}
-	}
+						   return true;
+					   });
 
-	return true;
+	return result;
 }
 
-template <typename ContainerType>
-typename ContainerType::value_type Algorithm::getEntityPtrById(ContainerType const& container, std::size_t id) noexcept
+template <typename T, bool AllowDuplicateNames, typename Predicate>
+Vector<T const*> Algorithm::getEntitiesByNameAndPredicate(EntityNameIndex<T, AllowDuplicateNames> const& index, std::string_view name, Predicate predicate)
 {
-	Entity::EntityImpl	searchedImpl("", id);
-	Entity				searchedEntity(&searchedImpl);
+	//When calling this method, we expect to have at least 2 results, so preallocate memory to avoid reallocations.
+	Vector<T const*> result(2);
+
+	index.foreachNamed(name, [&result, &predicate](T const& entity)
+					   {
+						   if (predicate(entity))
+						   {
+							   result.push_back(&entity);
+						   }
 
-	auto it = container.find(&searchedEntity);
+						   return true;
+					   });
+
+	return result;
+}
 
-	//When deleted, the Entity will try to delete the implementation pointer.
-	//As the implementation was not dynamically newed (to save perf), it crashes here.
-	//To avoid that, we force set the implementation to nullptr without deleting the previous one before entering ~Entity.
-	searchedEntity._pimpl.uncheckedSet(nullptr);
+template <typename T, bool AllowDuplicateNames, typename Visitor>
+bool Algorithm::foreachEntityNamed(EntityNameIndex<T, AllowDuplicateNames> const& index, std::string_view name, Visitor visitor)
+{
+	return index.foreachNamed(name, std::move(visitor));
+}
 
-	return (it != container.cend()) ? *it : nullptr;
+inline Entity const* Algorithm::getEntityPtrById(EntityIdIndex const& index, std::size_t id) noexcept
+{
+	return index.find(id);
 }
 
 template <typename ContainerType, typename Compare, typename ElementType, typename>
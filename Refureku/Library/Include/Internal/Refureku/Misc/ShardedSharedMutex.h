@@ -0,0 +1,79 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>	//std::size_t
+#include <shared_mutex>
+
+namespace rfk
+{
+	/**
+	*	Reader-writer lock split into multiple shards living on different cache lines.
+	*	Each thread always acquires the same shard in shared mode, so concurrent readers don't contend on a single cache line.
+	*	Exclusive locking acquires all shards (always in the same order).
+	*/
+	class ShardedSharedMutex final
+	{
+		public:
+			/** Number of shards of the mutex. */
+			static constexpr std::size_t	shardsCount = 16u;
+
+		private:
+			struct alignas(64) Shard
+			{
+				std::shared_mutex	mutex;
+			};
+
+			/** Shards of the mutex. */
+			std::array<Shard, shardsCount>	_shards;
+
+			/**
+			*	@brief Get the shard index associated to the calling thread.
+			* 
+			*	@return The shard index associated to the calling thread.
+			*/
+			static inline std::size_t	getThreadShardIndex()				noexcept;
+
+		public:
+			ShardedSharedMutex()							= default;
+			ShardedSharedMutex(ShardedSharedMutex const&)	= delete;
+			ShardedSharedMutex(ShardedSharedMutex&&)		= delete;
+			~ShardedSharedMutex()							= default;
+
+			/**
+			*	@brief Lock the mutex in exclusive mode.
+			*/
+			inline void					lock()								noexcept;
+
+			/**
+			*	@brief Unlock the mutex previously locked in exclusive mode.
+			*/
+			inline void					unlock()							noexcept;
+
+			/**
+			*	@brief Lock the mutex in shared mode.
+			* 
+			*	@return The index of the locked shard, which must be passed to unlockShared.
+			*/
+			inline std::size_t			lockShared()						noexcept;
+
+			/**
+			*	@brief Unlock the mutex previously locked in shared mode.
+			* 
+			*	@param shardIndex Index returned by the matching lockShared call.
+			*/
+			inline void					unlockShared(std::size_t shardIndex)	noexcept;
+
+			ShardedSharedMutex& operator=(ShardedSharedMutex const&)	= delete;
+			ShardedSharedMutex& operator=(ShardedSharedMutex&&)			= delete;
+	};
+
+	#include "Refureku/Misc/ShardedSharedMutex.inl"
+}
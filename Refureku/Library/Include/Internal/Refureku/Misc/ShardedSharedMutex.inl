@@ -0,0 +1,44 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::size_t ShardedSharedMutex::getThreadShardIndex() noexcept
+{
+	static std::atomic<std::size_t>	nextShardIndex{0u};
+	thread_local std::size_t		threadShardIndex = nextShardIndex.fetch_add(1u, std::memory_order_relaxed) % shardsCount;
+
+	return threadShardIndex;
+}
+
+inline void ShardedSharedMutex::lock() noexcept
+{
+	for (Shard& shard : _shards)
+	{
+		shard.mutex.lock();
+	}
+}
+
+inline void ShardedSharedMutex::unlock() noexcept
+{
+	for (std::size_t i = shardsCount; i > 0u; i--)
+	{
+		_shards[i - 1u].mutex.unlock();
+	}
+}
+
+inline std::size_t ShardedSharedMutex::lockShared() noexcept
+{
+	std::size_t shardIndex = getThreadShardIndex();
+
+	_shards[shardIndex].mutex.lock_shared();
+
+	return shardIndex;
+}
+
+inline void ShardedSharedMutex::unlockShared(std::size_t shardIndex) noexcept
+{
+	_shards[shardIndex].mutex.unlock_shared();
+}
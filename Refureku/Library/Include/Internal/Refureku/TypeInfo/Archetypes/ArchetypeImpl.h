@@ -22,7 +22,7 @@ namespace rfk
 			std::size_t			_memorySize			= 0;
 
 		public:
-			inline ArchetypeImpl(char const*		name,
+			inline ArchetypeImpl(EntityName		name,
 								 std::size_t		id,
 								 EEntityKind		kind,
 								 std::size_t		memorySize,
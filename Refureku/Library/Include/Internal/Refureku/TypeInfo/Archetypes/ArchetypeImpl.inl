@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Archetype::ArchetypeImpl::ArchetypeImpl(char const* name, std::size_t id, EEntityKind kind, std::size_t memorySize, Entity const* outerEntity) noexcept:
+inline Archetype::ArchetypeImpl::ArchetypeImpl(EntityName name, std::size_t id, EEntityKind kind, std::size_t memorySize, Entity const* outerEntity) noexcept:
 	Entity::EntityImpl(name, id, kind, outerEntity),
 	_accessSpecifier{EAccessSpecifier::Undefined},
 	_memorySize{memorySize}
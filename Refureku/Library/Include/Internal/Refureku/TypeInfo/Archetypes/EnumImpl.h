@@ -7,11 +7,18 @@
 
 #pragma once
 
+#include <algorithm>	//std::stable_sort, std::lower_bound, std::upper_bound
+#include <atomic>
+#include <memory>	//std::unique_ptr
+#include <mutex>
+#include <string_view>
+#include <utility>	//std::pair
 #include <vector>
 
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/ArchetypeImpl.h"
 #include "Refureku/TypeInfo/Archetypes/EnumValue.h"
+#include "Refureku/TypeInfo/Entity/EntityNameIndex.h"
 
 namespace rfk
 {
@@ -24,8 +31,63 @@ namespace rfk
 			/** Underlying type of this enum. */
 			Archetype const&			_underlyingArchetype;
 
+			struct EnumValuesIndices
+			{
+				/** Enum values of the enum hashed by name. */
+				EntityNameIndex<EnumValue>		byName;
+
+				/** Enum values of the enum sorted by value. Enum values sharing a value are kept in insertion order. */
+				std::vector<EnumValue const*>	byValue;
+
+				/**
+				*	First enum value holding each value in [smallestValue, smallestValue + byDenseValue.size()[, nullptr if none.
+				*	Only filled if the enum values are dense enough, in which case value lookups are a direct array access.
+				*/
+				std::vector<EnumValue const*>	byDenseValue;
+
+				/** Smallest value of the enum values, only meaningful if byDenseValue is not empty. */
+				int64							smallestValue = 0;
+			};
+
+			/**
+			*	Indices of _enumValues, computed on first use by updateEnumValuesIndices.
+			*	nullptr when enum values were added since the last computation.
+			*	Published snapshots are immutable, so readers can use them without any lock.
+			*/
+			mutable std::atomic<EnumValuesIndices const*>					_enumValuesIndices = nullptr;
+
+			/**
+			*	All the snapshots ever published to _enumValuesIndices.
+			*	Invalidated snapshots are kept alive until the enum is destroyed since readers might still use them.
+			*	Enum values are only added while the enum is filled, so usually a single snapshot is ever built.
+			*/
+			mutable std::vector<std::unique_ptr<EnumValuesIndices const>>	_enumValuesIndicesSnapshots;
+
+			/** Mutex preventing multiple threads from computing the enum values indices of this enum simultaneously. */
+			mutable std::mutex												_enumValuesIndicesMutex;
+
+			/**
+			*	The enum values are direct-mapped if the values range contains at most
+			*	_maxDenseRangeFactor times as many values as there are enum values.
+			*/
+			static constexpr uint64					_maxDenseRangeFactor = 2u;
+
+			/**
+			*	@brief Compute and publish the enum values indices from _enumValues if they are not up to date.
+			* 
+			*	@return The up to date enum values indices.
+			*/
+			inline EnumValuesIndices const&	updateEnumValuesIndices()	const	noexcept;
+
+			/**
+			*	@brief Get the enum values indices, computing them if they are not up to date with _enumValues.
+			* 
+			*	@return The up to date enum values indices.
+			*/
+			inline EnumValuesIndices const&	getEnumValuesIndices()		const	noexcept;
+
 		public:
-			inline EnumImpl(char const*			name,
+			inline EnumImpl(EntityName			name,
 							std::size_t			id,
 							Archetype const*	underlyingArchetype,
 							Entity const*	outerEntity = nullptr)	noexcept;
@@ -40,7 +102,7 @@ namespace rfk
 			*	
 			*	@return The added enum value.
 			*/
-			inline EnumValue&					addEnumValue(char const*	name,
+			inline EnumValue&					addEnumValue(EntityName	name,
 																 std::size_t	id,
 																 int64			value,
 																 Enum const*	backRef)			noexcept;
@@ -61,6 +123,35 @@ namespace rfk
 			*/
 			inline std::vector<EnumValue> const&	getEnumValues()							const	noexcept;
 
+			/**
+			*	@brief Search an enum value by name in constant time.
+			* 
+			*	@param name Name of the enum value.
+			* 
+			*	@return The enum value named name if any, else nullptr.
+			*/
+			RFK_NODISCARD inline EnumValue const*	getEnumValueByName(std::string_view name)	const	noexcept;
+
+			/**
+			*	@brief	Search the first enum value holding the provided value.
+			*			The lookup is a direct array access if the enum values are dense, else a binary search.
+			* 
+			*	@param value Value of the enum value.
+			* 
+			*	@return The first added enum value holding value if any, else nullptr.
+			*/
+			RFK_NODISCARD inline EnumValue const*	getEnumValue(int64 value)				const	noexcept;
+
+			/**
+			*	@brief Get the range of enum values holding the provided value, in insertion order.
+			* 
+			*	@param value Value of the enum values.
+			* 
+			*	@return A pair of pointers delimiting the range of enum values holding value.
+			*/
+			RFK_NODISCARD inline std::pair<EnumValue const* const*, EnumValue const* const*>
+													getEnumValues(int64 value)				const	noexcept;
+
 			/**
 			*	@brief Getter for the field _underlyingArchetype.
 			* 
@@ -5,14 +5,17 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Enum::EnumImpl::EnumImpl(char const* name, std::size_t id, Archetype const* underlyingArchetype, Entity const* outerEntity) noexcept:
+inline Enum::EnumImpl::EnumImpl(EntityName name, std::size_t id, Archetype const* underlyingArchetype, Entity const* outerEntity) noexcept:
 	ArchetypeImpl(name, id, EEntityKind::Enum, underlyingArchetype->getMemorySize(), outerEntity),
 	_underlyingArchetype{*underlyingArchetype}
 {
 }
 
-inline EnumValue& Enum::EnumImpl::addEnumValue(char const* name, std::size_t id, int64 value, Enum const*	backRef) noexcept
+inline EnumValue& Enum::EnumImpl::addEnumValue(EntityName name, std::size_t id, int64 value, Enum const*	backRef) noexcept
 {
+	//The indices store pointers to the enum values which might be reallocated
+	_enumValuesIndices.store(nullptr, std::memory_order_release);
+
 	return _enumValues.emplace_back(name, id, value, backRef);
 }
 
@@ -26,6 +29,110 @@ inline std::vector<EnumValue> const& Enum::EnumImpl::getEnumValues() const noexc
 	return _enumValues;
 }
 
+inline Enum::EnumImpl::EnumValuesIndices const& Enum::EnumImpl::updateEnumValuesIndices() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_enumValuesIndicesMutex);
+
+	//Another thread might have updated the indices while this thread was waiting for the lock
+	EnumValuesIndices const* result = _enumValuesIndices.load(std::memory_order_acquire);
+
+	if (result == nullptr)
+	{
+		std::unique_ptr<EnumValuesIndices> indices = std::make_unique<EnumValuesIndices>();
+
+		indices->byName.reserve(_enumValues.size());
+		indices->byValue.reserve(_enumValues.size());
+
+		for (EnumValue const& enumValue : _enumValues)
+		{
+			indices->byName.emplace(&enumValue);
+			indices->byValue.push_back(&enumValue);
+		}
+
+		std::stable_sort(indices->byValue.begin(), indices->byValue.end(), [](EnumValue const* lhs, EnumValue const* rhs)
+						 {
+							 return lhs->getValue() < rhs->getValue();
+						 });
+
+		if (!indices->byValue.empty())
+		{
+			int64 smallestValue = indices->byValue.front()->getValue();
+
+			//Compute the range in unsigned arithmetic so that it can't overflow
+			uint64 valuesRange = static_cast<uint64>(indices->byValue.back()->getValue()) - static_cast<uint64>(smallestValue);
+
+			if (valuesRange < _maxDenseRangeFactor * indices->byValue.size())
+			{
+				indices->byDenseValue.resize(static_cast<std::size_t>(valuesRange) + 1u, nullptr);
+
+				//Iterate backward so that the first added enum value holding a value is the one kept
+				for (auto it = indices->byValue.crbegin(); it != indices->byValue.crend(); it++)
+				{
+					indices->byDenseValue[static_cast<std::size_t>(static_cast<uint64>((*it)->getValue()) - static_cast<uint64>(smallestValue))] = *it;
+				}
+			}
+
+			indices->smallestValue = smallestValue;
+		}
+
+		result = indices.get();
+		_enumValuesIndicesSnapshots.push_back(std::move(indices));
+
+		_enumValuesIndices.store(result, std::memory_order_release);
+	}
+
+	return *result;
+}
+
+inline Enum::EnumImpl::EnumValuesIndices const& Enum::EnumImpl::getEnumValuesIndices() const noexcept
+{
+	EnumValuesIndices const* indices = _enumValuesIndices.load(std::memory_order_acquire);
+
+	return (indices != nullptr) ? *indices : updateEnumValuesIndices();
+}
+
+inline EnumValue const* Enum::EnumImpl::getEnumValueByName(std::string_view name) const noexcept
+{
+	return getEnumValuesIndices().byName.find(name);
+}
+
+inline EnumValue const* Enum::EnumImpl::getEnumValue(int64 value) const noexcept
+{
+	EnumValuesIndices const& indices = getEnumValuesIndices();
+
+	if (!indices.byDenseValue.empty())
+	{
+		uint64 offset = static_cast<uint64>(value) - static_cast<uint64>(indices.smallestValue);
+
+		return (offset < indices.byDenseValue.size()) ? indices.byDenseValue[static_cast<std::size_t>(offset)] : nullptr;
+	}
+	else
+	{
+		auto [first, last] = getEnumValues(value);
+
+		return (first != last) ? *first : nullptr;
+	}
+}
+
+inline std::pair<EnumValue const* const*, EnumValue const* const*> Enum::EnumImpl::getEnumValues(int64 value) const noexcept
+{
+	EnumValuesIndices const& indices = getEnumValuesIndices();
+
+	EnumValue const* const* begin	= indices.byValue.data();
+	EnumValue const* const* end		= begin + indices.byValue.size();
+
+	EnumValue const* const* first = std::lower_bound(begin, end, value, [](EnumValue const* enumValue, int64 searchedValue)
+													 {
+														 return enumValue->getValue() < searchedValue;
+													 });
+	EnumValue const* const* last = std::upper_bound(first, end, value, [](int64 searchedValue, EnumValue const* enumValue)
+													{
+														return searchedValue < enumValue->getValue();
+													});
+
+	return std::make_pair(first, last);
+}
+
 inline Archetype const& Enum::EnumImpl::getUnderlyingArchetype() const noexcept
 {
 	return _underlyingArchetype;
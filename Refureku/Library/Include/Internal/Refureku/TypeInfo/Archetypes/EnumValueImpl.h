@@ -19,7 +19,7 @@ namespace rfk
 			int64	_value = 0;
 
 		public:
-			inline EnumValueImpl(char const*		name,
+			inline EnumValueImpl(EntityName		name,
 								 std::size_t		id,
 								 int64				value,
 								 Entity const*	outerEntity = nullptr)	noexcept;
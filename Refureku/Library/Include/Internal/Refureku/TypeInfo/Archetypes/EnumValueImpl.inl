@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline EnumValue::EnumValueImpl::EnumValueImpl(char const* name, std::size_t id, int64 value, Entity const* outerEntity) noexcept:
+inline EnumValue::EnumValueImpl::EnumValueImpl(EntityName name, std::size_t id, int64 value, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, EEntityKind::EnumValue, outerEntity),
 	_value{value}
 {
@@ -13,7 +13,7 @@ namespace rfk
 	class FundamentalArchetype::FundamentalArchetypeImpl final : public Archetype::ArchetypeImpl
 	{
 		public:
-			inline FundamentalArchetypeImpl(char const*	name,
+			inline FundamentalArchetypeImpl(EntityName	name,
 											std::size_t	id,
 											std::size_t	memorySize)	noexcept;
 	};
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline FundamentalArchetype::FundamentalArchetypeImpl::FundamentalArchetypeImpl(char const* name, std::size_t id, std::size_t memorySize) noexcept:
+inline FundamentalArchetype::FundamentalArchetypeImpl::FundamentalArchetypeImpl(EntityName name, std::size_t id, std::size_t memorySize) noexcept:
 	ArchetypeImpl(name, id, EEntityKind::FundamentalArchetype, memorySize)
 {
 }
\ No newline at end of file
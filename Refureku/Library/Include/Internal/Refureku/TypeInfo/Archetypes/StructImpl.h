@@ -7,16 +7,22 @@
 
 #pragma once
 
-#include <unordered_set>
 #include <unordered_map>
+#include <array>
 #include <cstddef> //std::ptrdiff_t
 #include <cassert>
+#include <algorithm>	//std::reverse
+#include <atomic>
+#include <mutex>
+#include <memory>	//std::unique_ptr
+#include <vector>
 
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Archetypes/SubclassData.h"
 #include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
 #include "Refureku/TypeInfo/Archetypes/ArchetypeImpl.h"
-#include "Refureku/TypeInfo/Entity/EntityHash.h"
+#include "Refureku/TypeInfo/Entity/EntityArray.h"
+#include "Refureku/TypeInfo/Entity/EntityNameIndex.h"
 #include "Refureku/TypeInfo/Variables/Field.h"
 #include "Refureku/TypeInfo/Variables/StaticField.h"
 #include "Refureku/TypeInfo/Functions/Method.h"
@@ -30,12 +36,66 @@ namespace rfk
 		public:
 			using ParentStructs		= std::vector<ParentStruct>;
 			using Subclasses		= std::unordered_map<Struct const*, SubclassData>;
-			using NestedArchetypes	= std::unordered_set<Archetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using Fields			= std::unordered_multiset<Field, EntityNameHash, EntityNameEqual>;
-			using StaticFields		= std::unordered_multiset<StaticField, EntityNameHash, EntityNameEqual>;
-			using Methods			= std::unordered_multiset<Method, EntityNameHash, EntityNameEqual>;
-			using StaticMethods		= std::unordered_multiset<StaticMethod, EntityNameHash, EntityNameEqual>;
+			using NestedArchetypes	= EntityNameIndex<Archetype>;
+			using Fields			= EntityArray<Field>;
+			using StaticFields		= EntityArray<StaticField>;
+			using Methods			= EntityArray<Method>;
+			using StaticMethods		= EntityArray<StaticMethod>;
+			using FieldsByName			= EntityNameIndex<Field, true>;
+			using StaticFieldsByName	= EntityNameIndex<StaticField, true>;
+			using MethodsByName			= EntityNameIndex<Method, true>;
+			using StaticMethodsByName	= EntityNameIndex<StaticMethod, true>;
 			using Instantiators		= std::vector<StaticMethod const*>;
+			using InheritedMethods			= EntityNameIndex<Method, true>;
+			using InheritedStaticMethods	= EntityNameIndex<StaticMethod, true>;
+			using Ancestors					= std::vector<Struct const*>;
+
+			struct ResolvedInstantiators
+			{
+				/** Fingerprint of the parameter types of the resolved instantiators. */
+				uint64							parametersFingerprint;
+
+				/** Shared instantiator taking the resolved parameters, nullptr if none. */
+				StaticMethod const*				sharedInstantiator;
+
+				/** Unique instantiator taking the resolved parameters, nullptr if none. */
+				StaticMethod const*				uniqueInstantiator;
+
+				/** Instantiators resolved before these ones in the same bucket, nullptr if none. */
+				ResolvedInstantiators const*	next;
+			};
+
+			/** Number of buckets the resolved instantiators are spread into by parameters fingerprint. */
+			static constexpr std::size_t	resolvedInstantiatorsBucketsCount = 16u;
+
+			using ResolvedInstantiatorsBuckets	= std::array<std::atomic<ResolvedInstantiators const*>, resolvedInstantiatorsBucketsCount>;
+
+			struct InheritedMembers
+			{
+				/**
+				*	Methods of the struct followed by the methods of its parents (recursively, in declaration order), hashed by name.
+				*	Overriding methods are always found before the methods they override.
+				*/
+				InheritedMethods		methods;
+
+				/** Static methods of the struct followed by the static methods of its parents, see methods. */
+				InheritedStaticMethods	staticMethods;
+			};
+
+			struct AncestorsData
+			{
+				/**
+				*	Reflected ancestors of the struct, from the hierarchy root to the direct parent.
+				*	Only meaningful if isSingleInheritanceChain is true.
+				*/
+				Ancestors	ancestors;
+
+				/** Does the struct and all its ancestors have at most one reflected direct parent? */
+				bool		isSingleInheritanceChain		= true;
+
+				/** Is isSingleInheritanceChain true and the pointer offset from the struct to each of its ancestors 0? */
+				bool		hasZeroPointerOffsetAncestors	= true;
+			};
 		
 		private:
 			/** Structs this struct inherits directly in its declaration. This list includes ONLY reflected parents. */
@@ -47,18 +107,30 @@ namespace rfk
 			/** All reflected nested structs/classes/enums contained in this struct. */
 			NestedArchetypes	_nestedArchetypes;
 
-			/** All reflected fields contained in this struct, may they be declared in this struct or one of its parents. */
+			/** All reflected fields contained in this struct, may they be declared in this struct or one of its parents, in registration order. */
 			Fields				_fields;
 
-			/** All reflected static fields contained in this struct, may they be declared in this struct or one of its parents. */
+			/** All reflected static fields contained in this struct, may they be declared in this struct or one of its parents, in registration order. */
 			StaticFields		_staticFields;
 			
-			/** All reflected methods declared in this struct. */
+			/** All reflected methods declared in this struct, in registration order. */
 			Methods				_methods;
 
-			/** All reflected static methods declared in this struct. */
+			/** All reflected static methods declared in this struct, in registration order. */
 			StaticMethods		_staticMethods;
 
+			/** Name index of _fields. */
+			FieldsByName		_fieldsByName;
+
+			/** Name index of _staticFields. */
+			StaticFieldsByName	_staticFieldsByName;
+
+			/** Name index of _methods. */
+			MethodsByName		_methodsByName;
+
+			/** Name index of _staticMethods. */
+			StaticMethodsByName	_staticMethodsByName;
+
 			/** List of all custom instantiators returning rfk::SharedPtr for this archetype. */
 			Instantiators		_sharedInstantiators;
 
@@ -68,8 +140,104 @@ namespace rfk
 			/** Kind of a rfk::Struct or rfk::Class instance. */
 			EClassKind			_classKind;
 
+			/**
+			*	Inherited members of this struct, computed on first use by updateInheritedMembersCache.
+			*	nullptr when the struct hierarchy changed since the last computation.
+			*	Published snapshots are immutable, so readers can use them without any lock.
+			*/
+			mutable std::atomic<InheritedMembers const*>	_inheritedMembersCache = nullptr;
+
+			/** Ancestors data of this struct, computed on first use by updateAncestorsCache, see _inheritedMembersCache. */
+			mutable std::atomic<AncestorsData const*>		_ancestorsCache = nullptr;
+
+			/**
+			*	All the snapshots ever published to _inheritedMembersCache and _ancestorsCache.
+			*	Invalidated snapshots are kept alive until the struct is destroyed since readers might still use them.
+			*	The hierarchy only changes when entities are (un)registered, so only a few snapshots are ever built.
+			*/
+			mutable std::vector<std::unique_ptr<InheritedMembers const>>	_inheritedMembersSnapshots;
+			mutable std::vector<std::unique_ptr<AncestorsData const>>	_ancestorsSnapshots;
+
+			/** Mutex preventing multiple threads from computing the caches of this struct simultaneously. */
+			mutable std::mutex								_cachesMutex;
+
+			/**
+			*	Instantiators resolved by Struct::getInstantiator, hashed by the fingerprint of their parameter types.
+			*	Each bucket is an append-only list of immutable nodes published by a single atomic head, so instances can be made without any lock.
+			*	All heads are nullptr when no instantiator was resolved since the instantiators of this struct last changed.
+			*/
+			mutable ResolvedInstantiatorsBuckets			_resolvedInstantiators{};
+
+			/**
+			*	All the nodes ever linked in _resolvedInstantiators, kept alive until the struct is destroyed since readers might still walk them.
+			*	A node is only allocated the first time a parameters fingerprint is resolved, so memory grows linearly with the resolved fingerprints.
+			*/
+			mutable std::vector<std::unique_ptr<ResolvedInstantiators const>>	_resolvedInstantiatorsNodes;
+
+			/** Incremented each time an instantiator is added, so that instantiators resolved before the change are never memoized. */
+			std::atomic<uint64>								_instantiatorsGeneration = 0u;
+
+			/** Mutex serializing the updates of _resolvedInstantiators. */
+			mutable std::mutex								_resolvedInstantiatorsMutex;
+
+			/**
+			*	@brief Forget the resolved instantiators since a better match might have been added.
+			*	/!\ _resolvedInstantiatorsMutex must be locked by the calling thread.
+			*/
+			inline void									invalidateResolvedInstantiators()						noexcept;
+
+			/**
+			*	@brief Count the methods and static methods of this struct and all its parents (recursively).
+			* 
+			*	@param out_methodsCount			Incremented by the number of methods.
+			*	@param out_staticMethodsCount	Incremented by the number of static methods.
+			*/
+			inline void									countInheritedMembers(std::size_t& out_methodsCount,
+																			  std::size_t& out_staticMethodsCount)	const	noexcept;
+
+			/**
+			*	@brief Add the methods and static methods of this struct then the ones of all its parents (recursively) to the provided indices.
+			* 
+			*	@param out_methods			Index to fill with methods.
+			*	@param out_staticMethods	Index to fill with static methods.
+			*/
+			inline void									collectInheritedMembers(InheritedMethods&		out_methods,
+																				InheritedStaticMethods&	out_staticMethods)	const	noexcept;
+
+			/**
+			*	@brief Compute and publish the inherited members of this struct if they are not up to date.
+			* 
+			*	@return The up to date inherited members.
+			*/
+			inline InheritedMembers const&				updateInheritedMembersCache()								const	noexcept;
+
+			/**
+			*	@brief Get the inherited members of this struct, computing them if they are not up to date.
+			* 
+			*	@return The up to date inherited members.
+			*/
+			inline InheritedMembers const&				getInheritedMembers()										const	noexcept;
+
+			/**
+			*	@brief Compute and publish the ancestors data of this struct if they are not up to date.
+			* 
+			*	@param self The struct this implementation belongs to.
+			* 
+			*	@return The up to date ancestors data.
+			*/
+			inline AncestorsData const&					updateAncestorsCache(Struct const& self)					const	noexcept;
+
+			/**
+			*	@brief Get the ancestors data of this struct, computing them if they are not up to date.
+			* 
+			*	@param self The struct this implementation belongs to.
+			* 
+			*	@return The up to date ancestors data.
+			*/
+			inline AncestorsData const&					getAncestorsData(Struct const& self)						const	noexcept;
+
 		public:
-			inline StructImpl(char const*	name,
+			inline StructImpl(EntityName	name,
 							  std::size_t	id,
 							  std::size_t	memorySize,
 							  bool			isClass,
@@ -178,9 +346,9 @@ namespace rfk
 			*	@param memoryOffset	Offset in bytes of the field in the owner struct (obtained from offsetof).
 			*	@param outerEntity	Struct the field was first declared in (in case of inherited field, outerEntity is the parent struct).
 			*	
-			*	@return A pointer to the added field. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added field. The pointer stays valid as long as the struct is alive.
 			*/
-			RFK_NODISCARD inline Field*					addField(char const*	name,
+			RFK_NODISCARD inline Field*					addField(EntityName	name,
 																 std::size_t	id,
 																 Type const&	type,
 																 EFieldFlags	flags,
@@ -199,17 +367,16 @@ namespace rfk
 			*	@param fieldPtr		Pointer to the static field.
 			*	@param outerEntity	Struct the field was first declared in (in case of inherited field, outerEntity is the parent struct).
 			*	
-			*	@return A pointer to the added static field.
-			*			The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added static field. The pointer stays valid as long as the struct is alive.
 			*/
-			RFK_NODISCARD inline StaticField*			addStaticField(char const*		name,
+			RFK_NODISCARD inline StaticField*			addStaticField(EntityName		name,
 																	   std::size_t		id,
 																	   Type const&		type,
 																	   EFieldFlags		flags,
 																	   Struct const*	owner,
 																	   void*			fieldPtr,
 																	   Struct const*	outerEntity)					noexcept;
-			RFK_NODISCARD inline StaticField*			addStaticField(char const*		name,
+			RFK_NODISCARD inline StaticField*			addStaticField(EntityName		name,
 																	   std::size_t		id,
 																	   Type const&		type,
 																	   EFieldFlags		flags,
@@ -227,9 +394,9 @@ namespace rfk
 			*	@param flags			Method flags.
 			*	@param outerEntity		Struct containing the method declaration.
 			*
-			*	@return A pointer to the added method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added method. The pointer stays valid as long as the struct is alive.
 			*/
-			RFK_NODISCARD inline Method*				addMethod(char const*	name,
+			RFK_NODISCARD inline Method*				addMethod(EntityName	name,
 																  std::size_t	id,
 																  Type const&	returnType,
 																  ICallable*	internalMethod,
@@ -246,9 +413,9 @@ namespace rfk
 			*	@param flags			Method flags.
 			*	@param outerEntity		Struct containing the static method declaration.
 			*
-			*	@return A pointer to the added static method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added static method. The pointer stays valid as long as the struct is alive.
 			*/
-			RFK_NODISCARD inline StaticMethod*			addStaticMethod(char const*		name,
+			RFK_NODISCARD inline StaticMethod*			addStaticMethod(EntityName		name,
 																		std::size_t		id,
 																		Type const&		returnType,
 																		ICallable*		internalMethod,
@@ -315,6 +482,13 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline NestedArchetypes const&	getNestedArchetypes()								const	noexcept;
 
+			/**
+			*	@brief Getter for the field _fieldsByName.
+			* 
+			*	@return _fieldsByName.
+			*/
+			RFK_NODISCARD inline FieldsByName const&	getFieldsByName()									const	noexcept;
+
 			/**
 			*	@brief Getter for the field _fields.
 			* 
@@ -322,6 +496,13 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline Fields const&				getFields()											const	noexcept;
 
+			/**
+			*	@brief Getter for the field _staticFieldsByName.
+			* 
+			*	@return _staticFieldsByName.
+			*/
+			RFK_NODISCARD inline StaticFieldsByName const&	getStaticFieldsByName()									const	noexcept;
+
 			/**
 			*	@brief Getter for the field _staticFields.
 			* 
@@ -329,6 +510,13 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline StaticFields const&		getStaticFields()									const	noexcept;
 
+			/**
+			*	@brief Getter for the field _methodsByName.
+			* 
+			*	@return _methodsByName.
+			*/
+			RFK_NODISCARD inline MethodsByName const&	getMethodsByName()									const	noexcept;
+
 			/**
 			*	@brief Getter for the field _methods.
 			* 
@@ -336,6 +524,13 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline Methods const&				getMethods()										const	noexcept;
 
+			/**
+			*	@brief Getter for the field _staticMethodsByName.
+			* 
+			*	@return _staticMethodsByName.
+			*/
+			RFK_NODISCARD inline StaticMethodsByName const&	getStaticMethodsByName()									const	noexcept;
+
 			/**
 			*	@brief Getter for the field _staticMethods.
 			* 
@@ -343,6 +538,59 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline StaticMethods const&		getStaticMethods()									const	noexcept;
 
+			/**
+			*	@brief	Get the methods of this struct and all its parents, hashed by name.
+			*			Methods declared in a struct are always found before the methods declared in its parents.
+			*			The result is computed on first use and cached until the struct hierarchy changes.
+			* 
+			*	@return The methods of this struct and all its parents.
+			*/
+			RFK_NODISCARD inline InheritedMethods const&		getInheritedMethods()								const	noexcept;
+
+			/**
+			*	@brief	Get the static methods of this struct and all its parents, hashed by name.
+			*			Static methods declared in a struct are always found before the static methods declared in its parents.
+			*			The result is computed on first use and cached until the struct hierarchy changes.
+			* 
+			*	@return The static methods of this struct and all its parents.
+			*/
+			RFK_NODISCARD inline InheritedStaticMethods const&	getInheritedStaticMethods()							const	noexcept;
+
+			/**
+			*	@brief	Invalidate the inherited members cache of this struct and all its subclasses.
+			*			Must be called whenever the methods or the parents of this struct change.
+			*/
+			inline void										invalidateInheritedMembersCache()							noexcept;
+
+			/**
+			*	@brief	Invalidate the ancestors cache of this struct and all its subclasses.
+			*			Must be called whenever the parents of this struct change.
+			*/
+			inline void										invalidateAncestorsCache()									noexcept;
+
+			/**
+			*	@brief	Check whether this struct is the same as or a base of the provided struct.
+			*			If the provided struct only has single inheritance in its reflected hierarchy, the check is done in constant time
+			*			by comparing the structs depths in the hierarchy. Otherwise, fallback to a lookup in the subclasses map.
+			* 
+			*	@param self		The struct this implementation belongs to.
+			*	@param derived	The potential subclass.
+			* 
+			*	@return true if self is derived or a base of derived, else false.
+			*/
+			RFK_NODISCARD inline bool						isBaseOf(Struct const& self,
+																	 Struct const& derived)								const	noexcept;
+
+			/**
+			*	@brief	Check whether this struct has a single inheritance reflected hierarchy and all its ancestors are located at offset 0 in it,
+			*			in which case a pointer to an instance of this struct is also a valid pointer to any of its reflected ancestors.
+			* 
+			*	@param self The struct this implementation belongs to.
+			* 
+			*	@return true if no pointer adjustment is ever required to cast this struct to one of its reflected ancestors, else false.
+			*/
+			RFK_NODISCARD inline bool						hasZeroPointerOffsetAncestors(Struct const& self)			const	noexcept;
+
 			/**
 			*	@brief Getter for the field _sharedInstantiators.
 			* 
@@ -357,6 +605,35 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline Instantiators const&		getUniqueInstantiators()							const	noexcept;
 
+			/**
+			*	@brief Retrieve the instantiators previously resolved for a parameters fingerprint.
+			* 
+			*	@param parametersFingerprint	Fingerprint of the instantiators parameter types.
+			*	@param out_sharedInstantiator	Resolved shared instantiator if found, can be nullptr.
+			*	@param out_uniqueInstantiator	Resolved unique instantiator if found, can be nullptr.
+			*	@param out_generation			Generation of the instantiators, to provide to addResolvedInstantiators if nothing was found.
+			* 
+			*	@return true if instantiators were resolved for the provided fingerprint, else false.
+			*/
+			RFK_NODISCARD inline bool						getResolvedInstantiators(uint64					parametersFingerprint,
+																					 StaticMethod const*&	out_sharedInstantiator,
+																					 StaticMethod const*&	out_uniqueInstantiator,
+																					 uint64&				out_generation)			const	noexcept;
+
+			/**
+			*	@brief Remember the instantiators resolved for a parameters fingerprint.
+			* 
+			*	@param parametersFingerprint	Fingerprint of the instantiators parameter types.
+			*	@param sharedInstantiator		Resolved shared instantiator, can be nullptr.
+			*	@param uniqueInstantiator		Resolved unique instantiator, can be nullptr.
+			*	@param generation				Generation of the instantiators retrieved by getResolvedInstantiators before resolving.
+			*									Nothing is remembered if instantiators were added since then.
+			*/
+			inline void										addResolvedInstantiators(uint64					parametersFingerprint,
+																					 StaticMethod const*	sharedInstantiator,
+																					 StaticMethod const*	uniqueInstantiator,
+																					 uint64					generation)				const	noexcept;
+
 			/**
 			*	@brief Getter for the field _classKind.
 			* 
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Struct::StructImpl::StructImpl(char const* name, std::size_t	id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
+inline Struct::StructImpl::StructImpl(EntityName name, std::size_t	id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
 	ArchetypeImpl(name, id, isClass ? EEntityKind::Class : EEntityKind::Struct, memorySize, nullptr),
 	_classKind{classKind}
 {
@@ -17,16 +17,25 @@ inline void Struct::StructImpl::addDirectParent(Struct const& archetype, EAccess
 
 	//Inherit parent properties
 	inheritProperties(*archetype.getPimpl());
+
+	invalidateInheritedMembersCache();
+	invalidateAncestorsCache();
 }
 
 inline void Struct::StructImpl::removeDirectParentAt(std::size_t parentIndex) noexcept
 {
 	_directParents.erase(_directParents.begin() + parentIndex);
+
+	invalidateInheritedMembersCache();
+	invalidateAncestorsCache();
 }
 
 inline void Struct::StructImpl::addSubclass(Struct const& subclass, std::ptrdiff_t subclassPointerOffset) noexcept
 {
 	_subclasses.emplace(&subclass, subclassPointerOffset);
+
+	//The subclass pointer offsets to its ancestors are part of its ancestors cache
+	subclass.getPimpl()->_ancestorsCache.store(nullptr, std::memory_order_release);
 }
 
 inline void Struct::StructImpl::removeSubclassRecursive(rfk::Struct const& subclass) noexcept
@@ -43,64 +52,88 @@ inline void Struct::StructImpl::addNestedArchetype(Archetype const* nestedArchet
 												   EAccessSpecifier accessSpecifier, Struct const* outerEntity) noexcept
 {
 	//The hash is based on the archetype name which is immutable, so it's safe to const_cast to update other members.
-	Archetype* result = const_cast<Archetype*>(*_nestedArchetypes.emplace(nestedArchetype).first);
+	Archetype* result = const_cast<Archetype*>(_nestedArchetypes.emplace(nestedArchetype).first);
 
 	result->setAccessSpecifier(accessSpecifier);
 	result->setOuterEntity(outerEntity);
 }
 
-inline Field* Struct::StructImpl::addField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
+inline Field* Struct::StructImpl::addField(EntityName name, std::size_t id, Type const& type, EFieldFlags flags, 
 										   Struct const* owner, std::size_t memoryOffset, Struct const* outerEntity) noexcept
 {
-	assert(name != nullptr);
+	assert(name.getData() != nullptr);
 	assert((flags & EFieldFlags::Static) != EFieldFlags::Static);
 
-	//The hash is based on the field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<Field*>(&*_fields.emplace(name, id, type, flags, owner, memoryOffset, outerEntity));
+	Field& result = _fields.emplace_back(name, id, type, flags, owner, memoryOffset, outerEntity);
+
+	_fieldsByName.emplace(&result);
+
+	return &result;
 }
 
-inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
+inline StaticField* Struct::StructImpl::addStaticField(EntityName name, std::size_t id, Type const& type, EFieldFlags flags, 
 													   Struct const* owner, void* fieldPtr, Struct const* outerEntity) noexcept
 {
-	assert(name != nullptr);
+	assert(name.getData() != nullptr);
 	assert((flags & EFieldFlags::Static) == EFieldFlags::Static);
 
-	//The hash is based on the static field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+	StaticField& result = _staticFields.emplace_back(name, id, type, flags, owner, fieldPtr, outerEntity);
+
+	_staticFieldsByName.emplace(&result);
+
+	return &result;
 }
 
-inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
+inline StaticField* Struct::StructImpl::addStaticField(EntityName name, std::size_t id, Type const& type, EFieldFlags flags, 
 													   Struct const* owner, void const* fieldPtr, Struct const* outerEntity) noexcept
 {
-	assert(name != nullptr);
+	assert(name.getData() != nullptr);
 	assert((flags & EFieldFlags::Static) == EFieldFlags::Static);
 
-	//The hash is based on the static field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticField*>(&*_staticFields.emplace(name, id, type, flags, owner, fieldPtr, outerEntity));
+	StaticField& result = _staticFields.emplace_back(name, id, type, flags, owner, fieldPtr, outerEntity);
+
+	_staticFieldsByName.emplace(&result);
+
+	return &result;
 }
 
-inline Method* Struct::StructImpl::addMethod(char const* name, std::size_t id, Type const& returnType,
+inline Method* Struct::StructImpl::addMethod(EntityName name, std::size_t id, Type const& returnType,
 											 ICallable* internalMethod, EMethodFlags flags, Struct const*	outerEntity) noexcept
 {
-	assert(name != nullptr);
+	assert(name.getData() != nullptr);
 	assert((flags & EMethodFlags::Static) != EMethodFlags::Static);
 
-	//The hash is based on the method name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<Method*>(&*_methods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+	invalidateInheritedMembersCache();
+
+	Method& result = _methods.emplace_back(name, id, returnType, internalMethod, flags, outerEntity);
+
+	_methodsByName.emplace(&result);
+
+	return &result;
 }
 
-inline StaticMethod* Struct::StructImpl::addStaticMethod(char const* name, std::size_t id, Type const& returnType,
+inline StaticMethod* Struct::StructImpl::addStaticMethod(EntityName name, std::size_t id, Type const& returnType,
 														 ICallable* internalMethod, EMethodFlags flags, Struct const* outerEntity) noexcept
 {
-	assert(name != nullptr);
+	assert(name.getData() != nullptr);
 	assert((flags & EMethodFlags::Static) == EMethodFlags::Static);
 
-	//The hash is based on the static method name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<StaticMethod*>(&*_staticMethods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+	invalidateInheritedMembersCache();
+
+	StaticMethod& result = _staticMethods.emplace_back(name, id, returnType, internalMethod, flags, outerEntity);
+
+	_staticMethodsByName.emplace(&result);
+
+	return &result;
 }
 
 inline void Struct::StructImpl::addSharedInstantiator(StaticMethod const& instantiator) noexcept
 {
+	std::lock_guard<std::mutex> lock(_resolvedInstantiatorsMutex);
+
+	//The new instantiator might be a better match than the resolved ones
+	invalidateResolvedInstantiators();
+
 	std::size_t parametersCount = instantiator.getParametersCount();
 
 	//If it is a parameterless instantiator, use it as the (unique) default instantiator
@@ -136,6 +169,11 @@ inline void Struct::StructImpl::addSharedInstantiator(StaticMethod const& instan
 
 inline void Struct::StructImpl::addUniqueInstantiator(StaticMethod const& instantiator) noexcept
 {
+	std::lock_guard<std::mutex> lock(_resolvedInstantiatorsMutex);
+
+	//The new instantiator might be a better match than the resolved ones
+	invalidateResolvedInstantiators();
+
 	std::size_t parametersCount = instantiator.getParametersCount();
 
 	//If it is a parameterless instantiator, use it as the (unique) default instantiator
@@ -176,27 +214,31 @@ inline void Struct::StructImpl::setDirectParentsCapacity(std::size_t capacity) n
 
 inline void Struct::StructImpl::setNestedArchetypesCapacity(std::size_t capacity) noexcept
 {
-	_nestedArchetypes.rehash(capacity);
+	_nestedArchetypes.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setFieldsCapacity(std::size_t capacity) noexcept
 {
 	_fields.reserve(capacity);
+	_fieldsByName.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setStaticFieldsCapacity(std::size_t capacity) noexcept
 {
 	_staticFields.reserve(capacity);
+	_staticFieldsByName.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setMethodsCapacity(std::size_t capacity) noexcept
 {
 	_methods.reserve(capacity);
+	_methodsByName.reserve(capacity);
 }
 
 inline void Struct::StructImpl::setStaticMethodsCapacity(std::size_t capacity) noexcept
 {
 	_staticMethods.reserve(capacity);
+	_staticMethodsByName.reserve(capacity);
 }
 
 inline Archetype const* Struct::StructImpl::getNestedArchetype(char const* name, EAccessSpecifier access) const noexcept
@@ -236,26 +278,231 @@ inline Struct::StructImpl::NestedArchetypes const& Struct::StructImpl::getNested
 	return _nestedArchetypes;
 }
 
+inline Struct::StructImpl::FieldsByName const& Struct::StructImpl::getFieldsByName() const noexcept
+{
+	return _fieldsByName;
+}
+
 inline Struct::StructImpl::Fields const& Struct::StructImpl::getFields() const noexcept
 {
 	return _fields;
 }
 
+inline Struct::StructImpl::StaticFieldsByName const& Struct::StructImpl::getStaticFieldsByName() const noexcept
+{
+	return _staticFieldsByName;
+}
+
 inline Struct::StructImpl::StaticFields const& Struct::StructImpl::getStaticFields() const noexcept
 {
 	return _staticFields;
 }
 
+inline Struct::StructImpl::MethodsByName const& Struct::StructImpl::getMethodsByName() const noexcept
+{
+	return _methodsByName;
+}
+
 inline Struct::StructImpl::Methods const& Struct::StructImpl::getMethods() const noexcept
 {
 	return _methods;
 }
 
+inline Struct::StructImpl::StaticMethodsByName const& Struct::StructImpl::getStaticMethodsByName() const noexcept
+{
+	return _staticMethodsByName;
+}
+
 inline Struct::StructImpl::StaticMethods const& Struct::StructImpl::getStaticMethods() const noexcept
 {
 	return _staticMethods;
 }
 
+inline void Struct::StructImpl::countInheritedMembers(std::size_t& out_methodsCount, std::size_t& out_staticMethodsCount) const noexcept
+{
+	out_methodsCount		+= _methods.size();
+	out_staticMethodsCount	+= _staticMethods.size();
+
+	for (ParentStruct const& parent : _directParents)
+	{
+		parent.getArchetype().getPimpl()->countInheritedMembers(out_methodsCount, out_staticMethodsCount);
+	}
+}
+
+inline void Struct::StructImpl::collectInheritedMembers(InheritedMethods& out_methods, InheritedStaticMethods& out_staticMethods) const noexcept
+{
+	for (Method const& method : _methods)
+	{
+		out_methods.emplace(&method);
+	}
+
+	for (StaticMethod const& staticMethod : _staticMethods)
+	{
+		out_staticMethods.emplace(&staticMethod);
+	}
+
+	//Parents are inspected depth first, in declaration order, like the non-cached inherited lookups
+	for (ParentStruct const& parent : _directParents)
+	{
+		parent.getArchetype().getPimpl()->collectInheritedMembers(out_methods, out_staticMethods);
+	}
+}
+
+inline Struct::StructImpl::InheritedMembers const& Struct::StructImpl::updateInheritedMembersCache() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_cachesMutex);
+
+	//Another thread might have updated the cache while this thread was waiting for the lock
+	InheritedMembers const* result = _inheritedMembersCache.load(std::memory_order_acquire);
+
+	if (result == nullptr)
+	{
+		std::size_t methodsCount		= 0u;
+		std::size_t staticMethodsCount	= 0u;
+
+		countInheritedMembers(methodsCount, staticMethodsCount);
+
+		//Allocate all the memory upfront: entities sharing a name must be found in insertion order,
+		//which is only guaranteed if the indices are never rehashed while being filled.
+		std::unique_ptr<InheritedMembers> inheritedMembers = std::make_unique<InheritedMembers>();
+
+		inheritedMembers->methods.reserve(methodsCount);
+		inheritedMembers->staticMethods.reserve(staticMethodsCount);
+
+		collectInheritedMembers(inheritedMembers->methods, inheritedMembers->staticMethods);
+
+		result = inheritedMembers.get();
+		_inheritedMembersSnapshots.push_back(std::move(inheritedMembers));
+
+		_inheritedMembersCache.store(result, std::memory_order_release);
+	}
+
+	return *result;
+}
+
+inline Struct::StructImpl::InheritedMembers const& Struct::StructImpl::getInheritedMembers() const noexcept
+{
+	InheritedMembers const* inheritedMembers = _inheritedMembersCache.load(std::memory_order_acquire);
+
+	return (inheritedMembers != nullptr) ? *inheritedMembers : updateInheritedMembersCache();
+}
+
+inline Struct::StructImpl::InheritedMethods const& Struct::StructImpl::getInheritedMethods() const noexcept
+{
+	return getInheritedMembers().methods;
+}
+
+inline Struct::StructImpl::InheritedStaticMethods const& Struct::StructImpl::getInheritedStaticMethods() const noexcept
+{
+	return getInheritedMembers().staticMethods;
+}
+
+inline void Struct::StructImpl::invalidateInheritedMembersCache() noexcept
+{
+	_inheritedMembersCache.store(nullptr, std::memory_order_release);
+
+	//_subclasses contains all subclasses, regardless of their inheritance depth
+	for (auto& [subclass, subclassData] : _subclasses)
+	{
+		subclass->getPimpl()->_inheritedMembersCache.store(nullptr, std::memory_order_release);
+	}
+}
+
+inline Struct::StructImpl::AncestorsData const& Struct::StructImpl::updateAncestorsCache(Struct const& self) const noexcept
+{
+	std::lock_guard<std::mutex> lock(_cachesMutex);
+
+	//Another thread might have updated the cache while this thread was waiting for the lock
+	AncestorsData const* result = _ancestorsCache.load(std::memory_order_acquire);
+
+	if (result == nullptr)
+	{
+		//Walk up the hierarchy without using the parents cache so that no other struct lock is taken
+		std::unique_ptr<AncestorsData>	ancestorsData	= std::make_unique<AncestorsData>();
+		StructImpl const*				current			= this;
+
+		while (!current->_directParents.empty())
+		{
+			if (current->_directParents.size() > 1u)
+			{
+				ancestorsData->isSingleInheritanceChain			= false;
+				ancestorsData->hasZeroPointerOffsetAncestors	= false;
+				ancestorsData->ancestors.clear();
+				break;
+			}
+
+			Struct const&	parent = current->_directParents.front().getArchetype();
+			std::ptrdiff_t	pointerOffset;
+
+			if (!parent.getPimpl()->getPointerOffset(self, pointerOffset) || pointerOffset != 0)
+			{
+				ancestorsData->hasZeroPointerOffsetAncestors = false;
+			}
+
+			ancestorsData->ancestors.push_back(&parent);
+			current = parent.getPimpl();
+		}
+
+		//Ancestors were pushed from the direct parent to the root
+		std::reverse(ancestorsData->ancestors.begin(), ancestorsData->ancestors.end());
+
+		result = ancestorsData.get();
+		_ancestorsSnapshots.push_back(std::move(ancestorsData));
+
+		_ancestorsCache.store(result, std::memory_order_release);
+	}
+
+	return *result;
+}
+
+inline Struct::StructImpl::AncestorsData const& Struct::StructImpl::getAncestorsData(Struct const& self) const noexcept
+{
+	AncestorsData const* ancestorsData = _ancestorsCache.load(std::memory_order_acquire);
+
+	return (ancestorsData != nullptr) ? *ancestorsData : updateAncestorsCache(self);
+}
+
+inline void Struct::StructImpl::invalidateAncestorsCache() noexcept
+{
+	_ancestorsCache.store(nullptr, std::memory_order_release);
+
+	//_subclasses contains all subclasses, regardless of their inheritance depth
+	for (auto& [subclass, subclassData] : _subclasses)
+	{
+		subclass->getPimpl()->_ancestorsCache.store(nullptr, std::memory_order_release);
+	}
+}
+
+inline bool Struct::StructImpl::isBaseOf(Struct const& self, Struct const& derived) const noexcept
+{
+	if (&self == &derived)
+	{
+		return true;
+	}
+
+	AncestorsData const& derivedAncestorsData = derived.getPimpl()->getAncestorsData(derived);
+
+	if (derivedAncestorsData.isSingleInheritanceChain)
+	{
+		AncestorsData const& ancestorsData = getAncestorsData(self);
+
+		//If self had multiple parents, it couldn't be part of the single inheritance chain of derived.
+		//Otherwise, self is a base of derived only if it is at its own depth in the derived ancestors.
+		return	ancestorsData.isSingleInheritanceChain &&
+				ancestorsData.ancestors.size() < derivedAncestorsData.ancestors.size() &&
+				derivedAncestorsData.ancestors[ancestorsData.ancestors.size()] == &self;
+	}
+	else
+	{
+		return _subclasses.find(&derived) != _subclasses.cend();
+	}
+}
+
+inline bool Struct::StructImpl::hasZeroPointerOffsetAncestors(Struct const& self) const noexcept
+{
+	return getAncestorsData(self).hasZeroPointerOffsetAncestors;
+}
+
 inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getSharedInstantiators() const noexcept
 {
 	return _sharedInstantiators;
@@ -266,6 +513,65 @@ inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getUniqueIns
 	return _uniqueInstantiators;
 }
 
+inline bool Struct::StructImpl::getResolvedInstantiators(uint64 parametersFingerprint, StaticMethod const*& out_sharedInstantiator, StaticMethod const*& out_uniqueInstantiator, uint64& out_generation) const noexcept
+{
+	//Load the generation first: once it is observed, the nodes invalidated before it was incremented can't be loaded anymore
+	out_generation = _instantiatorsGeneration.load(std::memory_order_acquire);
+
+	for (ResolvedInstantiators const* resolvedInstantiators = _resolvedInstantiators[parametersFingerprint % resolvedInstantiatorsBucketsCount].load(std::memory_order_acquire);
+		 resolvedInstantiators != nullptr;
+		 resolvedInstantiators = resolvedInstantiators->next)
+	{
+		if (resolvedInstantiators->parametersFingerprint == parametersFingerprint)
+		{
+			out_sharedInstantiator = resolvedInstantiators->sharedInstantiator;
+			out_uniqueInstantiator = resolvedInstantiators->uniqueInstantiator;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+inline void Struct::StructImpl::addResolvedInstantiators(uint64 parametersFingerprint, StaticMethod const* sharedInstantiator, StaticMethod const* uniqueInstantiator, uint64 generation) const noexcept
+{
+	std::lock_guard<std::mutex> lock(_resolvedInstantiatorsMutex);
+
+	//Instantiators were added while these ones were resolved, so they might not be the best match anymore
+	if (generation != _instantiatorsGeneration.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	std::atomic<ResolvedInstantiators const*>& bucket = _resolvedInstantiators[parametersFingerprint % resolvedInstantiatorsBucketsCount];
+	ResolvedInstantiators const* head = bucket.load(std::memory_order_relaxed);
+
+	//Another thread might have memoized the same fingerprint in the meantime
+	for (ResolvedInstantiators const* resolvedInstantiators = head; resolvedInstantiators != nullptr; resolvedInstantiators = resolvedInstantiators->next)
+	{
+		if (resolvedInstantiators->parametersFingerprint == parametersFingerprint)
+		{
+			return;
+		}
+	}
+
+	//Link the new node in front of the bucket: the nodes already published are never modified
+	_resolvedInstantiatorsNodes.push_back(std::make_unique<ResolvedInstantiators const>(ResolvedInstantiators{ parametersFingerprint, sharedInstantiator, uniqueInstantiator, head }));
+	bucket.store(_resolvedInstantiatorsNodes.back().get(), std::memory_order_release);
+}
+
+inline void Struct::StructImpl::invalidateResolvedInstantiators() noexcept
+{
+	//Unpublish the nodes before incrementing the generation so that readers observing the new generation never see them
+	for (std::atomic<ResolvedInstantiators const*>& bucket : _resolvedInstantiators)
+	{
+		bucket.store(nullptr, std::memory_order_relaxed);
+	}
+
+	_instantiatorsGeneration.fetch_add(1u, std::memory_order_release);
+}
+
 inline EClassKind Struct::StructImpl::getClassKind() const noexcept
 {
 	return _classKind;
@@ -8,26 +8,94 @@
 #pragma once
 
 #include <vector>
-#include <unordered_set>
+#include <unordered_map>
+#include <algorithm>	//std::find, std::find_if, std::remove
 
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
 #include "Refureku/TypeInfo/Archetypes/StructImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateParameter.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateArgument.h"
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiation.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 namespace rfk
 {
 	class ClassTemplate::ClassTemplateImpl final : public Struct::StructImpl
 	{
 		private:
+			/** Instantiations sharing a same hash, in registration order. */
+			using InstantiationsByHash = std::unordered_map<std::size_t, std::vector<ClassTemplateInstantiation const*>>;
+
+			struct IndexedInstantiation
+			{
+				/** Rank of the instantiation in the registration order, used to keep the hash buckets sorted. */
+				std::size_t					registrationRank;
+
+				/** Combined hash of all the template arguments currently added to the instantiation. */
+				std::size_t					argumentsHash;
+
+				/**
+				*	Hash of each template argument currently added to the instantiation.
+				*	Kept here since the template arguments might be destroyed before the instantiation is unregistered.
+				*/
+				std::vector<std::size_t>	argumentHashes;
+			};
+
 			/** List of all template parameters of this class template. */
-			std::vector<TemplateParameter const*>					_templateParameters;
+			std::vector<TemplateParameter const*>				_templateParameters;
 			
-			/** All different instantiations of this class template in the program (with different template parameters). */
-			std::unordered_set<ClassTemplateInstantiation const*>	_templateInstantiations;
+			/** All different instantiations of this class template in the program (with different template parameters), in registration order. */
+			std::vector<ClassTemplateInstantiation const*>		_templateInstantiations;
+
+			/** Instantiations indexed by the combined hash of all their template arguments. */
+			InstantiationsByHash								_templateInstantiationsByArgumentsHash;
+
+			/** For each template argument position, instantiations indexed by the hash of their template argument at this position. */
+			std::vector<InstantiationsByHash>					_templateInstantiationsByArgumentHash;
+
+			/** Indexing data of each registered instantiation. */
+			std::unordered_map<ClassTemplateInstantiation const*, IndexedInstantiation>	_indexedInstantiations;
+
+			/** Registration rank of the next registered instantiation. */
+			std::size_t											_nextRegistrationRank = 0u;
+
+			/**
+			*	@brief Insert an instantiation in a hash bucket, keeping the bucket sorted by registration order.
+			* 
+			*	@param index			The index containing the bucket.
+			*	@param hash				The hash of the bucket.
+			*	@param instantiation	The instantiation to insert.
+			*/
+			inline void					insertInBucket(InstantiationsByHash&				index,
+													   std::size_t							hash,
+													   ClassTemplateInstantiation const&	instantiation)				noexcept;
+
+			/**
+			*	@brief Remove an instantiation from a hash bucket, removing the bucket if it becomes empty.
+			* 
+			*	@param index			The index containing the bucket.
+			*	@param hash				The hash of the bucket.
+			*	@param instantiation	The instantiation to remove.
+			*/
+			inline static void			eraseFromBucket(InstantiationsByHash&				index,
+														std::size_t							hash,
+														ClassTemplateInstantiation const&	instantiation)				noexcept;
+
+			/**
+			*	@brief Check whether an instantiation matches the provided template arguments.
+			* 
+			*	@param instantiation	The instantiation to check.
+			*	@param args				Pointer to an array of argument pointers. nullptr arguments match any argument.
+			*	@param argsCount		Number of template arguments.
+			* 
+			*	@return true if the instantiation matches all the provided template arguments, else false.
+			*/
+			RFK_NODISCARD inline static bool	matchTemplateArguments(ClassTemplateInstantiation const&	instantiation,
+																	   TemplateArgument const**				args,
+																	   std::size_t							argsCount)		noexcept;
 
 		public:
-			inline ClassTemplateImpl(char const*	name,
+			inline ClassTemplateImpl(EntityName	name,
 									 std::size_t	id,
 									 bool			isClass)	noexcept;
 
@@ -45,6 +113,14 @@ namespace rfk
 			*/
 			inline void																			removeTemplateInstantiation(ClassTemplateInstantiation const& instantiation)	noexcept;
 
+			/**
+			*	@brief	Index the last template argument added to a registered instantiation.
+			*			Instantiations are registered before their template arguments are added, so the indices are updated incrementally.
+			* 
+			*	@param instantiation The instantiation a template argument was added to.
+			*/
+			inline void																			indexLastTemplateArgument(ClassTemplateInstantiation const& instantiation)		noexcept;
+
 			/**
 			*	@brief Append a template parameter to _templateParameters.
 			* 
@@ -52,6 +128,19 @@ namespace rfk
 			*/
 			inline void																			addTemplateParameter(TemplateParameter const& param)							noexcept;
 
+			/**
+			*	@brief	Get the first registered instantiation matching the provided template arguments.
+			*			Fully specified arguments are looked up with a single hash, nullptr (wildcard) arguments
+			*			are looked up from the most selective specified argument.
+			* 
+			*	@param args			Pointer to an array of argument pointers. nullptr arguments match any argument.
+			*	@param argsCount	Number of template arguments.
+			* 
+			*	@return The first registered instantiation matching the provided arguments if any, else nullptr.
+			*/
+			RFK_NODISCARD inline ClassTemplateInstantiation const*								getTemplateInstantiation(TemplateArgument const**	args,
+																														 std::size_t				argsCount)			const	noexcept;
+
 			/**
 			*	@brief Getter for the field _templateParameters.
 			* 
@@ -64,7 +153,7 @@ namespace rfk
 			* 
 			*	@return _templateInstantiations.
 			*/
-			RFK_NODISCARD inline std::unordered_set<ClassTemplateInstantiation const*> const&	getTemplateInstantiations()												const	noexcept;
+			RFK_NODISCARD inline std::vector<ClassTemplateInstantiation const*> const&			getTemplateInstantiations()												const	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.inl"
@@ -5,19 +5,113 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline ClassTemplate::ClassTemplateImpl::ClassTemplateImpl(char const* name, std::size_t id, bool isClass) noexcept:
+inline ClassTemplate::ClassTemplateImpl::ClassTemplateImpl(EntityName name, std::size_t id, bool isClass) noexcept:
 	StructImpl(name, id, 0u, isClass, EClassKind::Template)
 {
 }
 
 inline void ClassTemplate::ClassTemplateImpl::addTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
 {
-	_templateInstantiations.insert(&instantiation);
+	_templateInstantiations.push_back(&instantiation);
+
+	IndexedInstantiation& indexedInstantiation = _indexedInstantiations[&instantiation];
+
+	indexedInstantiation.registrationRank	= _nextRegistrationRank++;
+	indexedInstantiation.argumentsHash		= static_cast<std::size_t>(fnv1aOffsetBasis);
+
+	//Template arguments are usually added after the registration, but index the ones already added if any
+	if (_templateInstantiationsByArgumentHash.size() < instantiation.getTemplateArgumentsCount())
+	{
+		_templateInstantiationsByArgumentHash.resize(instantiation.getTemplateArgumentsCount());
+	}
+
+	for (std::size_t i = 0u; i < instantiation.getTemplateArgumentsCount(); i++)
+	{
+		std::size_t argumentHash = instantiation.getTemplateArgumentAt(i).computeHash();
+
+		insertInBucket(_templateInstantiationsByArgumentHash[i], argumentHash, instantiation);
+		indexedInstantiation.argumentHashes.push_back(argumentHash);
+		indexedInstantiation.argumentsHash = static_cast<std::size_t>(combineHash(indexedInstantiation.argumentsHash, argumentHash));
+	}
+
+	insertInBucket(_templateInstantiationsByArgumentsHash, indexedInstantiation.argumentsHash, instantiation);
 }
 
 inline void ClassTemplate::ClassTemplateImpl::removeTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
 {
-	_templateInstantiations.erase(&instantiation);
+	auto it = std::find(_templateInstantiations.cbegin(), _templateInstantiations.cend(), &instantiation);
+
+	if (it != _templateInstantiations.cend())
+	{
+		_templateInstantiations.erase(it);
+
+		auto indexedIt = _indexedInstantiations.find(&instantiation);
+
+		for (std::size_t i = 0u; i < indexedIt->second.argumentHashes.size(); i++)
+		{
+			eraseFromBucket(_templateInstantiationsByArgumentHash[i], indexedIt->second.argumentHashes[i], instantiation);
+		}
+
+		eraseFromBucket(_templateInstantiationsByArgumentsHash, indexedIt->second.argumentsHash, instantiation);
+		_indexedInstantiations.erase(indexedIt);
+	}
+}
+
+inline void ClassTemplate::ClassTemplateImpl::indexLastTemplateArgument(ClassTemplateInstantiation const& instantiation) noexcept
+{
+	auto it = _indexedInstantiations.find(&instantiation);
+
+	if (it == _indexedInstantiations.cend())
+	{
+		return;
+	}
+
+	std::size_t	argumentIndex	= instantiation.getTemplateArgumentsCount() - 1u;
+	std::size_t	argumentHash	= instantiation.getTemplateArgumentAt(argumentIndex).computeHash();
+
+	if (_templateInstantiationsByArgumentHash.size() <= argumentIndex)
+	{
+		_templateInstantiationsByArgumentHash.resize(argumentIndex + 1u);
+	}
+
+	insertInBucket(_templateInstantiationsByArgumentHash[argumentIndex], argumentHash, instantiation);
+	it->second.argumentHashes.push_back(argumentHash);
+
+	//Move the instantiation to the bucket of its new combined arguments hash
+	eraseFromBucket(_templateInstantiationsByArgumentsHash, it->second.argumentsHash, instantiation);
+	it->second.argumentsHash = static_cast<std::size_t>(combineHash(it->second.argumentsHash, argumentHash));
+	insertInBucket(_templateInstantiationsByArgumentsHash, it->second.argumentsHash, instantiation);
+}
+
+inline void ClassTemplate::ClassTemplateImpl::insertInBucket(InstantiationsByHash& index, std::size_t hash, ClassTemplateInstantiation const& instantiation) noexcept
+{
+	std::vector<ClassTemplateInstantiation const*>&	bucket				= index[hash];
+	std::size_t										registrationRank	= _indexedInstantiations[&instantiation].registrationRank;
+
+	//Arguments of an instantiation might be added after a more recently registered instantiation was indexed
+	auto it = std::find_if(bucket.cbegin(), bucket.cend(), [this, registrationRank](ClassTemplateInstantiation const* indexed)
+						   {
+							   return _indexedInstantiations[indexed].registrationRank > registrationRank;
+						   });
+
+	bucket.insert(it, &instantiation);
+}
+
+inline void ClassTemplate::ClassTemplateImpl::eraseFromBucket(InstantiationsByHash& index, std::size_t hash, ClassTemplateInstantiation const& instantiation) noexcept
+{
+	auto bucketIt = index.find(hash);
+
+	if (bucketIt != index.end())
+	{
+		std::vector<ClassTemplateInstantiation const*>& bucket = bucketIt->second;
+
+		bucket.erase(std::remove(bucket.begin(), bucket.end(), &instantiation), bucket.end());
+
+		if (bucket.empty())
+		{
+			index.erase(bucketIt);
+		}
+	}
 }
 
 inline void ClassTemplate::ClassTemplateImpl::addTemplateParameter(TemplateParameter const& param) noexcept
@@ -25,12 +119,103 @@ inline void ClassTemplate::ClassTemplateImpl::addTemplateParameter(TemplateParam
 	_templateParameters.push_back(&param);
 }
 
+inline bool ClassTemplate::ClassTemplateImpl::matchTemplateArguments(ClassTemplateInstantiation const& instantiation, TemplateArgument const** args, std::size_t argsCount) noexcept
+{
+	if (instantiation.getTemplateArgumentsCount() < argsCount)
+	{
+		return false;
+	}
+
+	for (std::size_t i = 0u; i < argsCount; i++)
+	{
+		if (args[i] != nullptr && instantiation.getTemplateArgumentAt(i) != *args[i])
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+inline ClassTemplateInstantiation const* ClassTemplate::ClassTemplateImpl::getTemplateInstantiation(TemplateArgument const** args, std::size_t argsCount) const noexcept
+{
+	if (args == nullptr || argsCount == 0u)
+	{
+		return nullptr;
+	}
+
+	std::vector<ClassTemplateInstantiation const*> const* candidates = nullptr;
+
+	if (argsCount == _templateParameters.size() && std::find(args, args + argsCount, nullptr) == args + argsCount)
+	{
+		//All arguments are specified: a single lookup in the combined hash index
+		uint64 argumentsHash = fnv1aOffsetBasis;
+
+		for (std::size_t i = 0u; i < argsCount; i++)
+		{
+			argumentsHash = combineHash(argumentsHash, args[i]->computeHash());
+		}
+
+		auto it = _templateInstantiationsByArgumentsHash.find(static_cast<std::size_t>(argumentsHash));
+
+		if (it == _templateInstantiationsByArgumentsHash.cend())
+		{
+			return nullptr;
+		}
+
+		candidates = &it->second;
+	}
+	else
+	{
+		//Some arguments are wildcards: look up the smallest bucket among the specified arguments
+		for (std::size_t i = 0u; i < argsCount; i++)
+		{
+			if (args[i] != nullptr)
+			{
+				if (i >= _templateInstantiationsByArgumentHash.size())
+				{
+					return nullptr;
+				}
+
+				auto it = _templateInstantiationsByArgumentHash[i].find(args[i]->computeHash());
+
+				if (it == _templateInstantiationsByArgumentHash[i].cend())
+				{
+					return nullptr;
+				}
+
+				if (candidates == nullptr || it->second.size() < candidates->size())
+				{
+					candidates = &it->second;
+				}
+			}
+		}
+
+		//Only wildcards: any instantiation with enough arguments matches
+		if (candidates == nullptr)
+		{
+			candidates = &_templateInstantiations;
+		}
+	}
+
+	//Buckets are sorted by registration order, so the first match is always the same
+	for (ClassTemplateInstantiation const* instantiation : *candidates)
+	{
+		if (matchTemplateArguments(*instantiation, args, argsCount))
+		{
+			return instantiation;
+		}
+	}
+
+	return nullptr;
+}
+
 inline std::vector<TemplateParameter const*> const& ClassTemplate::ClassTemplateImpl::getTemplateParameters() const noexcept
 {
 	return _templateParameters;
 }
 
-inline std::unordered_set<ClassTemplateInstantiation const*> const& ClassTemplate::ClassTemplateImpl::getTemplateInstantiations() const noexcept
+inline std::vector<ClassTemplateInstantiation const*> const& ClassTemplate::ClassTemplateImpl::getTemplateInstantiations() const noexcept
 {
 	return _templateInstantiations;
 }
\ No newline at end of file
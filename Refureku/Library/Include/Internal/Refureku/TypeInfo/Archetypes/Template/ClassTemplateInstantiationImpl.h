@@ -26,7 +26,7 @@ namespace rfk
 			std::vector<TemplateArgument const*>	_templateArguments;
 
 		public:
-			inline ClassTemplateInstantiationImpl(char const*		name,
+			inline ClassTemplateInstantiationImpl(EntityName		name,
 												  std::size_t		id,
 												  std::size_t		memorySize,
 												  bool				isClass,
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline ClassTemplateInstantiation::ClassTemplateInstantiationImpl::ClassTemplateInstantiationImpl(char const* name, std::size_t id, std::size_t memorySize,
+inline ClassTemplateInstantiation::ClassTemplateInstantiationImpl::ClassTemplateInstantiationImpl(EntityName name, std::size_t id, std::size_t memorySize,
 																									 bool isClass, Archetype const& classTemplate) noexcept:
 	StructImpl(name, id, memorySize, isClass, EClassKind::TemplateInstantiation),
 	_classTemplate{static_cast<ClassTemplate const&>(classTemplate)}
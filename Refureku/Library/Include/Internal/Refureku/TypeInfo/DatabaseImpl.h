@@ -8,14 +8,19 @@
 #pragma once
 
 #include <unordered_set>
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <cassert>
 #include <iostream>
 
 #include "Refureku/Misc/SharedPtr.h"
+#include "Refureku/Misc/ShardedSharedMutex.h"
+#include "Refureku/Misc/InitializationGuard.h"
 #include "Refureku/TypeInfo/Database.h"
 #include "Refureku/TypeInfo/Entity/EntityHash.h"
+#include "Refureku/TypeInfo/Entity/EntityIdIndex.h"
+#include "Refureku/TypeInfo/Entity/EntityNameIndex.h"
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 #include "Refureku/TypeInfo/Namespace/NamespaceFragment.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
@@ -28,23 +33,86 @@
 #include "Refureku/TypeInfo/Functions/Method.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
+#include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
+#include "Refureku/Properties/Property.h"
 
 namespace rfk
 {
 	class Database::DatabaseImpl final
 	{
 		public:
-			using EntitiesById					= std::unordered_set<Entity const*, EntityPtrIdHash, EntityPtrIdEqual>;
-			using NamespacesByName				= std::unordered_set<Namespace const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using StructsByName					= std::unordered_set<Struct const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using ClassesByName					= std::unordered_set<Class const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using EnumsByName					= std::unordered_set<Enum const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using VariablesByName				= std::unordered_set<Variable const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using FunctionsByName				= std::unordered_multiset<Function const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using FundamentalArchetypesByName	= std::unordered_set<FundamentalArchetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
+			using EntitiesById					= EntityIdIndex;
+			using NamespacesByName				= EntityNameIndex<Namespace>;
+			using StructsByName					= EntityNameIndex<Struct>;
+			using ClassesByName					= EntityNameIndex<Class>;
+			using EnumsByName					= EntityNameIndex<Enum>;
+			using VariablesByName				= EntityNameIndex<Variable>;
+			using FunctionsByName				= EntityNameIndex<Function, true>;
+			using FundamentalArchetypesByName	= EntityNameIndex<FundamentalArchetype>;
 			using GenNamespaces					= std::unordered_map<std::size_t, SharedPtr<Namespace>>;
+			using EntitiesSet					= std::unordered_set<Entity const*>;
+
+			struct EntitiesWithProperty
+			{
+				/** Registered entities carrying a property whose archetype is exactly the indexed archetype. */
+				EntitiesSet	withArchetype;
+
+				/** Registered entities carrying a property whose archetype is the indexed archetype or one of its subclasses. */
+				EntitiesSet	withArchetypeOrSubclass;
+			};
+
+			using EntitiesByProperty			= std::unordered_map<Struct const*, EntitiesWithProperty>;
+
+			/**
+			*	RAII guard locking the database for reading.
+			*	Reentrant: nested read guards (or read guards created while the thread holds the write lock) don't lock again.
+			*/
+			class ReadLockGuard final
+			{
+				private:
+					/** Database the guard locks. */
+					DatabaseImpl const&	_database;
+
+					/** Index of the locked shard, or ShardedSharedMutex::shardsCount if this guard didn't lock anything. */
+					std::size_t			_shardIndex;
+
+				public:
+					inline explicit ReadLockGuard(DatabaseImpl const& database)	noexcept;
+					ReadLockGuard(ReadLockGuard const&)							= delete;
+					ReadLockGuard(ReadLockGuard&&)								= delete;
+					inline ~ReadLockGuard()										noexcept;
+			};
+
+			/**
+			*	RAII guard locking the database for writing.
+			*	Reentrant: nested write guards don't lock again.
+			*/
+			class WriteLockGuard final
+			{
+				private:
+					/** Database the guard locks. */
+					DatabaseImpl const&	_database;
+
+				public:
+					inline explicit WriteLockGuard(DatabaseImpl const& database)	noexcept;
+					WriteLockGuard(WriteLockGuard const&)							= delete;
+					WriteLockGuard(WriteLockGuard&&)								= delete;
+					inline ~WriteLockGuard()										noexcept;
+			};
 			
 		private:
+			/** Lock protecting the database indices as well as the content of the namespaces generated by the database. */
+			mutable ShardedSharedMutex	_mutex;
+
+			/** Number of read locks currently held by the calling thread. */
+			inline static thread_local std::size_t	_threadReadLockDepth = 0u;
+
+			/** Number of write locks currently held by the calling thread. */
+			inline static thread_local std::size_t	_threadWriteLockDepth = 0u;
+
+			/** Incremented each time entities are registered to or unregistered from the database. */
+			inline static std::atomic<uint64>		_registrationGeneration = 0u;
+
 			/** Collection of all registered entities hashed by Id.  */
 			EntitiesById				_entitiesById;
 
@@ -72,8 +140,49 @@ namespace rfk
 			/** Collection of namespace objects generated by the database. */
 			GenNamespaces				_generatedNamespaces;
 
+			/** Registered entities hashed by the archetype of the properties they carry. */
+			EntitiesByProperty			_entitiesByProperty;
+
+			/**
+			*	@brief	Index an entity under the archetypes of the properties attached to another entity.
+			*			Each property is indexed under its archetype and all the reflected parents of its archetype.
+			*	
+			*	@param entity			The entity to index.
+			*	@param propertiesOwner	The entity carrying the properties to index entity with (entity itself, or a fragment of entity).
+			*/
+			inline void		registerEntityProperties(Entity const& entity,
+													 Entity const& propertiesOwner)							noexcept;
+
+			/**
+			*	@brief Index an entity under a property archetype and all its reflected parents, recursively.
+			*	
+			*	@param entity			The entity to index.
+			*	@param archetype		The archetype to index entity under.
+			*	@param isExactMatch		Is archetype the archetype of the property carried by the entity?
+			*/
+			inline void		registerEntityProperty(Entity const&	entity,
+												   Struct const&	archetype,
+												   bool				isExactMatch)							noexcept;
+
+			/**
+			*	@brief Remove an entity from the indices of the archetypes of its properties.
+			*	
+			*	@param entity The entity to remove.
+			*/
+			inline void		unregisterEntityProperties(Entity const& entity)						noexcept;
+
 			/**
-			*	@brief Register an entity to the database.
+			*	@brief Remove an entity from the indices of a property archetype and all its reflected parents, recursively.
+			*	
+			*	@param entity		The entity to remove.
+			*	@param archetype	The archetype to remove the entity from.
+			*/
+			inline void		unregisterEntityProperty(Entity const&	entity,
+													 Struct const&	archetype)								noexcept;
+
+			/**
+			*	@brief	Register an entity to the database.
+			*			Its properties are indexed only if no entity with the same id is already registered.
 			*	
 			*	@param entity The entity to register.
 			*/
@@ -131,6 +240,33 @@ namespace rfk
 		public:
 			DatabaseImpl()	= default;
 			~DatabaseImpl()	= default;
+
+			/**
+			*	@brief	Lock the database for writing from the calling thread.
+			*			Calls can be nested, the database is unlocked when the last matching unlockWrite is called.
+			*/
+			inline void							lockWrite()														const	noexcept;
+
+			/**
+			*	@brief Release a write lock previously acquired with lockWrite by the calling thread.
+			*/
+			inline void							unlockWrite()													const	noexcept;
+
+			/**
+			*	@brief Check whether the calling thread currently owns the database write lock.
+			*
+			*	@return true if the calling thread owns the database write lock, else false.
+			*/
+			RFK_NODISCARD inline static bool	ownsWriteLock()															noexcept;
+
+			/**
+			*	@brief	Getter for the field _registrationGeneration.
+			*			Caches indexed by archetype addresses must be dropped when it changes, since the archetypes of an unloaded module
+			*			can be replaced by other archetypes at the same addresses.
+			*
+			*	@return _registrationGeneration.
+			*/
+			RFK_NODISCARD inline static uint64	getRegistrationGeneration()												noexcept;
 			
 			/**
 			*	@brief	Register a file level entity to the database (add it to both _entitiesById & _fileLevelEntitiesByName),
@@ -162,6 +298,16 @@ namespace rfk
 			*/
 			inline void							unregisterEntityRecursive(Entity const&	entity)							noexcept;
 
+			/**
+			*	@brief	Index a registered entity under the archetype of a property attached to it after its registration.
+			*			The caller must own the database write lock.
+			*	
+			*	@param entity	The registered entity.
+			*	@param property	The property attached to entity.
+			*/
+			inline void							registerEntityAddedProperty(Entity const&	entity,
+																			Property const&	property)						noexcept;
+
 			/**
 			*	@brief	Remove a namespace from the database if it is not referenced by other namespace fragments.
 			*
@@ -181,6 +327,18 @@ namespace rfk
 				SharedPtr<Namespace>			getOrCreateNamespace(char const*	name,
 																	 std::size_t	id)									noexcept;
 
+			/**
+			*	@brief Get the registered entities carrying a property of the provided archetype.
+			*	
+			*	@param archetype			Archetype of the property.
+			*	@param isChildClassValid	If true, also consider entities carrying a property inheriting from archetype.
+			*	
+			*	@return The set of matching entities if any, else nullptr.
+			*/
+			RFK_NODISCARD inline 
+				EntitiesSet const*				getEntitiesWithProperty(Struct const&	archetype,
+																		bool			isChildClassValid)		const	noexcept;
+
 			/**
 			*	@brief Getters for each field.
 			*/
@@ -5,8 +5,83 @@
 *	See the LICENSE.md file for full license details.
 */
 
+inline Database::DatabaseImpl::ReadLockGuard::ReadLockGuard(DatabaseImpl const& database) noexcept:
+	_database{database},
+	_shardIndex{ShardedSharedMutex::shardsCount}
+{
+	//Only lock if the calling thread doesn't own a lock on the database yet
+	if (_threadReadLockDepth == 0u && _threadWriteLockDepth == 0u)
+	{
+		//See InitializationGuard for the lock order
+		assert(!internal::InitializationGuard::isInitializingOnCallingThread());
+
+		_shardIndex = _database._mutex.lockShared();
+	}
+
+	_threadReadLockDepth++;
+}
+
+inline Database::DatabaseImpl::ReadLockGuard::~ReadLockGuard() noexcept
+{
+	_threadReadLockDepth--;
+
+	if (_shardIndex != ShardedSharedMutex::shardsCount)
+	{
+		_database._mutex.unlockShared(_shardIndex);
+	}
+}
+
+inline Database::DatabaseImpl::WriteLockGuard::WriteLockGuard(DatabaseImpl const& database) noexcept:
+	_database{database}
+{
+	_database.lockWrite();
+}
+
+inline Database::DatabaseImpl::WriteLockGuard::~WriteLockGuard() noexcept
+{
+	_database.unlockWrite();
+}
+
+inline void Database::DatabaseImpl::lockWrite() const noexcept
+{
+	//A thread reading the database can't upgrade its lock to a write lock
+	assert(_threadReadLockDepth == 0u || _threadWriteLockDepth != 0u);
+
+	if (_threadWriteLockDepth++ == 0u)
+	{
+		//See InitializationGuard for the lock order
+		assert(!internal::InitializationGuard::isInitializingOnCallingThread());
+
+		_mutex.lock();
+	}
+}
+
+inline void Database::DatabaseImpl::unlockWrite() const noexcept
+{
+	assert(_threadWriteLockDepth != 0u);
+
+	if (--_threadWriteLockDepth == 0u)
+	{
+		_mutex.unlock();
+	}
+}
+
+inline bool Database::DatabaseImpl::ownsWriteLock() noexcept
+{
+	return _threadWriteLockDepth != 0u;
+}
+
+inline uint64 Database::DatabaseImpl::getRegistrationGeneration() noexcept
+{
+	return _registrationGeneration.load(std::memory_order_acquire);
+}
+
 inline void Database::DatabaseImpl::registerFileLevelEntityRecursive(Entity const& entity) noexcept
 {
+	WriteLockGuard lock(*this);
+
+	_registrationGeneration.fetch_add(1u, std::memory_order_release);
+
 	assert(entity.getOuterEntity() == nullptr);
 
 	//Register by name
@@ -65,6 +140,10 @@ inline void Database::DatabaseImpl::registerFileLevelEntityRecursive(Entity cons
 
 inline void Database::DatabaseImpl::unregisterEntityRecursive(Entity const& entity) noexcept
 {
+	WriteLockGuard lock(*this);
+
+	_registrationGeneration.fetch_add(1u, std::memory_order_release);
+
 	switch (entity.getKind())
 	{
 		case EEntityKind::NamespaceFragment:
@@ -113,8 +192,14 @@ inline void Database::DatabaseImpl::unregisterEntityRecursive(Entity const& enti
 
 inline void Database::DatabaseImpl::unregisterEntity(Entity const& entity) noexcept
 {
+	WriteLockGuard lock(*this);
+
 	//Remove this entity from the list of registered entity ids
-	_entitiesById.erase(&entity);
+	//The properties of an entity which lost a double registration were never indexed
+	if (_entitiesById.erase(&entity))
+	{
+		unregisterEntityProperties(entity);
+	}
 
 	//Remove the entity from the suitable file level entities collection if applicable
 	if (entity.getOuterEntity() == nullptr)
@@ -177,10 +262,97 @@ inline void Database::DatabaseImpl::registerEntityId(Entity const& entity) noexc
 	//Emit a warning if 2 entities with the same ID are registered.
 	if (!result.second)
 	{
-		Entity const* foundEntity = *_entitiesById.find(&entity);
+		Entity const* foundEntity = result.first;
 
 		std::cout << "[Refureku] WARNING: Double registration detected: (" << entity.getId() << ", " << entity.getName() <<
 			") collides with entity: (" << foundEntity->getId() << ", " << foundEntity->getName() << ")" << std::endl;
+
+		//Only index the properties of registered entities, so that the reverse index never references an entity the database can't return
+		return;
+	}
+
+	registerEntityProperties(entity, entity);
+}
+
+inline void Database::DatabaseImpl::registerEntityProperties(Entity const& entity, Entity const& propertiesOwner) noexcept
+{
+	struct Data
+	{
+		DatabaseImpl*	database;
+		Entity const&	entity;
+	} data{ this, entity };
+
+	propertiesOwner.foreachProperty([](Property const& property, void* userData)
+									{
+										Data& data = *reinterpret_cast<Data*>(userData);
+
+										data.database->registerEntityProperty(data.entity, property.getArchetype(), true);
+
+										return true;
+									}, &data);
+}
+
+inline void Database::DatabaseImpl::registerEntityProperty(Entity const& entity, Struct const& archetype, bool isExactMatch) noexcept
+{
+	EntitiesWithProperty& entities = _entitiesByProperty[&archetype];
+
+	if (isExactMatch)
+	{
+		entities.withArchetype.emplace(&entity);
+	}
+
+	entities.withArchetypeOrSubclass.emplace(&entity);
+
+	for (std::size_t i = 0u; i < archetype.getDirectParentsCount(); i++)
+	{
+		registerEntityProperty(entity, archetype.getDirectParentAt(i).getArchetype(), false);
+	}
+}
+
+inline void Database::DatabaseImpl::registerEntityAddedProperty(Entity const& entity, Property const& property) noexcept
+{
+	assert(ownsWriteLock());
+
+	registerEntityProperty(entity, property.getArchetype(), true);
+}
+
+inline void Database::DatabaseImpl::unregisterEntityProperties(Entity const& entity) noexcept
+{
+	struct Data
+	{
+		DatabaseImpl*	database;
+		Entity const&	entity;
+	} data{ this, entity };
+
+	entity.foreachProperty([](Property const& property, void* userData)
+						   {
+							   Data& data = *reinterpret_cast<Data*>(userData);
+
+							   data.database->unregisterEntityProperty(data.entity, property.getArchetype());
+
+							   return true;
+						   }, &data);
+}
+
+inline void Database::DatabaseImpl::unregisterEntityProperty(Entity const& entity, Struct const& archetype) noexcept
+{
+	auto it = _entitiesByProperty.find(&archetype);
+
+	if (it != _entitiesByProperty.end())
+	{
+		it->second.withArchetype.erase(&entity);
+		it->second.withArchetypeOrSubclass.erase(&entity);
+
+		//Don't keep empty entries for archetypes which are not used anymore (unloaded modules for example)
+		if (it->second.withArchetypeOrSubclass.empty())
+		{
+			_entitiesByProperty.erase(it);
+		}
+	}
+
+	for (std::size_t i = 0u; i < archetype.getDirectParentsCount(); i++)
+	{
+		unregisterEntityProperty(entity, archetype.getDirectParentAt(i).getArchetype());
 	}
 }
 
@@ -228,12 +400,19 @@ inline void Database::DatabaseImpl::registerSubEntitesId(Entity const& entity) n
 
 inline void Database::DatabaseImpl::registerEntityIdRecursive(Entity const& entity) noexcept
 {
+	WriteLockGuard lock(*this);
+
+	_registrationGeneration.fetch_add(1u, std::memory_order_release);
+
 	registerEntityId(entity);
 	registerSubEntitesId(entity);
 }
 
 inline void Database::DatabaseImpl::registerNamespaceFragmentSubEntities(NamespaceFragment const& frag) noexcept
 {
+	//The properties of a fragment are merged into its namespace, which is registered before its fragments
+	registerEntityProperties(frag.getMergedNamespace(), frag);
+
 	frag.foreachNestedEntity([](Entity const& nestedEntity, void* userData)
 							 {
 								 switch (nestedEntity.getKind())
@@ -367,6 +546,8 @@ inline void Database::DatabaseImpl::unregisterEnumSubEntities(Enum const& e) noe
 
 inline void Database::DatabaseImpl::releaseNamespaceIfUnreferenced(SharedPtr<Namespace> const& npPtr) noexcept
 {
+	WriteLockGuard lock(*this);
+
 	assert(npPtr.use_count() >= 2);
 
 	// 2: first is this method parameter, the second is the ptr stored in _generatedNamespaces
@@ -381,6 +562,8 @@ inline void Database::DatabaseImpl::releaseNamespaceIfUnreferenced(SharedPtr<Nam
 
 inline SharedPtr<Namespace> Database::DatabaseImpl::getOrCreateNamespace(char const* name, std::size_t id) noexcept
 {
+	WriteLockGuard lock(*this);
+
 	auto it = _generatedNamespaces.find(id);
 
 	if (it != _generatedNamespaces.cend())
@@ -403,6 +586,18 @@ inline SharedPtr<Namespace> Database::DatabaseImpl::getOrCreateNamespace(char co
 	}
 }
 
+inline Database::DatabaseImpl::EntitiesSet const* Database::DatabaseImpl::getEntitiesWithProperty(Struct const& archetype, bool isChildClassValid) const noexcept
+{
+	auto it = _entitiesByProperty.find(&archetype);
+
+	if (it == _entitiesByProperty.cend())
+	{
+		return nullptr;
+	}
+
+	return isChildClassValid ? &it->second.withArchetypeOrSubclass : &it->second.withArchetype;
+}
+
 inline Database::DatabaseImpl::EntitiesById const& Database::DatabaseImpl::getEntitiesById() const noexcept
 {
 	return _entitiesById;
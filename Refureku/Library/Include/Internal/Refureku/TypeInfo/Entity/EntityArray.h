@@ -0,0 +1,152 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t, std::ptrdiff_t
+#include <iterator>		//std::forward_iterator_tag
+#include <new>			//placement new
+#include <utility>		//std::forward
+#include <vector>
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/MetadataArena.h"
+
+namespace rfk
+{
+	/**
+	*	Contiguous storage of entities, iterated in insertion order.
+	*	Entities are stored in chunks which are never reallocated, so a pointer to a stored entity stays valid until the array is destroyed.
+	*	When the final number of entities is reserved before the first insertion (as the generated code does),
+	*	all entities live in a single contiguous chunk.
+	*	Chunks are allocated with internal::MetadataAllocator, so they come from the current MetadataArena if any.
+	*
+	*	@tparam T Entity type stored in the array.
+	*/
+	template <typename T>
+	class EntityArray final
+	{
+		private:
+			struct Chunk
+			{
+				/** Storage of the chunk, big enough to contain capacity entities. */
+				T*			data		= nullptr;
+
+				/** Number of constructed entities in the chunk. */
+				std::size_t	size		= 0u;
+
+				/** Maximum number of entities the chunk can contain. */
+				std::size_t	capacity	= 0u;
+			};
+
+		public:
+			using value_type = T;
+
+			class const_iterator
+			{
+				private:
+					/** Chunk containing the current entity. */
+					Chunk const*	_chunk;
+
+					/** Past-the-end chunk. */
+					Chunk const*	_chunksEnd;
+
+					/** Index of the current entity in _chunk. */
+					std::size_t		_index;
+
+					/**
+					*	@brief Move _chunk to the first non-empty chunk starting at _chunk.
+					*/
+					inline void	skipEmptyChunks()	noexcept;
+
+				public:
+					using iterator_category	= std::forward_iterator_tag;
+					using value_type		= T;
+					using difference_type	= std::ptrdiff_t;
+					using pointer			= T const*;
+					using reference			= T const&;
+
+					inline const_iterator(Chunk const* chunk,
+										  Chunk const* chunksEnd)			noexcept;
+
+					inline reference		operator*()				const	noexcept;
+					inline pointer			operator->()			const	noexcept;
+					inline const_iterator&	operator++()					noexcept;
+					inline const_iterator	operator++(int)					noexcept;
+					inline bool				operator==(const_iterator const& other)	const	noexcept;
+					inline bool				operator!=(const_iterator const& other)	const	noexcept;
+			};
+
+		private:
+			/** Minimum number of entities allocated in a chunk when an entity is added to a full array. */
+			static constexpr std::size_t	_minChunkCapacity = 4u;
+
+			/** Chunks of the array, in insertion order. */
+			std::vector<Chunk, internal::MetadataAllocator<Chunk>>	_chunks;
+
+			/** Total number of entities contained in the array. */
+			std::size_t			_size		= 0u;
+
+			/** Total number of entities the array can contain without allocating a new chunk. */
+			std::size_t			_capacity	= 0u;
+
+			/**
+			*	@brief Allocate a new empty chunk at the end of the array.
+			*
+			*	@param capacity Number of entities the new chunk can contain.
+			*/
+			inline void	allocateChunk(std::size_t capacity);
+
+		public:
+			EntityArray()								= default;
+			EntityArray(EntityArray const&)				= delete;
+			EntityArray(EntityArray&&)					= delete;
+			inline ~EntityArray()												noexcept;
+
+			/**
+			*	@brief Construct a new entity at the end of the array.
+			*
+			*	@param args Arguments forwarded to the entity constructor.
+			*
+			*	@return A reference to the constructed entity.
+			*/
+			template <typename... ArgTypes>
+			T&									emplace_back(ArgTypes&&... args);
+
+			/**
+			*	@brief	Make sure the array can contain at least the provided number of entities without allocating a new chunk.
+			*			If the array is empty, the whole capacity is allocated in a single chunk.
+			*
+			*	@param capacity Number of entities the array should be able to contain.
+			*/
+			inline void							reserve(std::size_t capacity);
+
+			/**
+			*	@brief Get the number of entities contained in the array.
+			*
+			*	@return The number of entities contained in the array.
+			*/
+			RFK_NODISCARD inline std::size_t	size()							const	noexcept;
+
+			/**
+			*	@brief Check whether the array contains no entity.
+			*
+			*	@return true if the array contains no entity, else false.
+			*/
+			RFK_NODISCARD inline bool			empty()							const	noexcept;
+
+			RFK_NODISCARD inline const_iterator	begin()							const	noexcept;
+			RFK_NODISCARD inline const_iterator	end()							const	noexcept;
+			RFK_NODISCARD inline const_iterator	cbegin()						const	noexcept;
+			RFK_NODISCARD inline const_iterator	cend()							const	noexcept;
+
+			EntityArray& operator=(EntityArray const&)	= delete;
+			EntityArray& operator=(EntityArray&&)		= delete;
+	};
+
+	#include "Refureku/TypeInfo/Entity/EntityArray.inl"
+}
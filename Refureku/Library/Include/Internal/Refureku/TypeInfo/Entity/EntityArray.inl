@@ -0,0 +1,170 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+inline EntityArray<T>::const_iterator::const_iterator(Chunk const* chunk, Chunk const* chunksEnd) noexcept:
+	_chunk{chunk},
+	_chunksEnd{chunksEnd},
+	_index{0u}
+{
+	skipEmptyChunks();
+}
+
+template <typename T>
+inline void EntityArray<T>::const_iterator::skipEmptyChunks() noexcept
+{
+	while (_chunk != _chunksEnd && _chunk->size == 0u)
+	{
+		_chunk++;
+	}
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator::reference EntityArray<T>::const_iterator::operator*() const noexcept
+{
+	return _chunk->data[_index];
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator::pointer EntityArray<T>::const_iterator::operator->() const noexcept
+{
+	return _chunk->data + _index;
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator& EntityArray<T>::const_iterator::operator++() noexcept
+{
+	if (++_index == _chunk->size)
+	{
+		_index = 0u;
+		_chunk++;
+		skipEmptyChunks();
+	}
+
+	return *this;
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator EntityArray<T>::const_iterator::operator++(int) noexcept
+{
+	const_iterator result = *this;
+
+	++(*this);
+
+	return result;
+}
+
+template <typename T>
+inline bool EntityArray<T>::const_iterator::operator==(const_iterator const& other) const noexcept
+{
+	return _chunk == other._chunk && _index == other._index;
+}
+
+template <typename T>
+inline bool EntityArray<T>::const_iterator::operator!=(const_iterator const& other) const noexcept
+{
+	return !(*this == other);
+}
+
+template <typename T>
+inline EntityArray<T>::~EntityArray() noexcept
+{
+	internal::MetadataAllocator<T> allocator;
+
+	for (Chunk& chunk : _chunks)
+	{
+		for (std::size_t i = 0u; i < chunk.size; i++)
+		{
+			chunk.data[i].~T();
+		}
+
+		allocator.deallocate(chunk.data, chunk.capacity);
+	}
+}
+
+template <typename T>
+inline void EntityArray<T>::allocateChunk(std::size_t capacity)
+{
+	Chunk chunk;
+
+	chunk.data		= internal::MetadataAllocator<T>().allocate(capacity);
+	chunk.capacity	= capacity;
+
+	_chunks.push_back(chunk);
+	_capacity += capacity;
+}
+
+template <typename T>
+template <typename... ArgTypes>
+T& EntityArray<T>::emplace_back(ArgTypes&&... args)
+{
+	if (_size == _capacity)
+	{
+		//Grow geometrically so that the number of chunks stays logarithmic
+		allocateChunk((_capacity > _minChunkCapacity) ? _capacity : _minChunkCapacity);
+	}
+
+	//Fill the chunks in order: the first non-full chunk is the first chunk able to contain the new entity
+	Chunk* chunk = _chunks.data();
+
+	while (chunk->size == chunk->capacity)
+	{
+		chunk++;
+	}
+
+	T* entity = new (chunk->data + chunk->size) T(std::forward<ArgTypes>(args)...);
+
+	chunk->size++;
+	_size++;
+
+	return *entity;
+}
+
+template <typename T>
+inline void EntityArray<T>::reserve(std::size_t capacity)
+{
+	if (capacity > _capacity)
+	{
+		allocateChunk(capacity - _capacity);
+	}
+}
+
+template <typename T>
+inline std::size_t EntityArray<T>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T>
+inline bool EntityArray<T>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator EntityArray<T>::begin() const noexcept
+{
+	return const_iterator(_chunks.data(), _chunks.data() + _chunks.size());
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator EntityArray<T>::end() const noexcept
+{
+	return const_iterator(_chunks.data() + _chunks.size(), _chunks.data() + _chunks.size());
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator EntityArray<T>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template <typename T>
+inline typename EntityArray<T>::const_iterator EntityArray<T>::cend() const noexcept
+{
+	return end();
+}
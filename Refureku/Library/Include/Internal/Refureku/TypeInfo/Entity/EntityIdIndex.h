@@ -0,0 +1,128 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <cstdint>	//std::uint64_t
+#include <utility>	//std::pair
+#include <vector>
+#include <cassert>
+
+#include "Refureku/TypeInfo/Entity/Entity.h"
+
+namespace rfk
+{
+	/**
+	*	Flat open-addressing hash index mapping entity ids to entity pointers.
+	*	(id, Entity*) pairs are stored inline in a single power-of-2 sized array and collisions are resolved with linear probing,
+	*	so a lookup never dereferences an entity and usually touches a single cache line.
+	*	Erasure uses backward shift deletion so no tombstone is ever left in the table.
+	*/
+	class EntityIdIndex final
+	{
+		public:
+			using value_type = Entity const*;
+
+		private:
+			struct Slot
+			{
+				/** Id of the entity stored in this slot. Only meaningful if entity is not nullptr. */
+				std::size_t		id		= 0u;
+
+				/** Entity stored in this slot, nullptr if the slot is empty. */
+				Entity const*	entity	= nullptr;
+			};
+
+			/** Minimum number of slots allocated when the first entity is inserted. Must be a power of 2. */
+			static constexpr std::size_t	_minCapacity = 64u;
+
+			/** Slots of the index. The size of this vector is always 0 or a power of 2. */
+			std::vector<Slot>	_slots;
+
+			/** Number of non-empty slots. */
+			std::size_t			_size = 0u;
+
+			/**
+			*	@brief Compute the preferred slot index of an id.
+			*			Ids are mixed before being masked so that poorly distributed ids (manually provided ids for example) don't cluster.
+			* 
+			*	@param id	Id to compute the slot of.
+			*	@param mask	Slots count - 1.
+			* 
+			*	@return The index of the slot the id should ideally be stored in.
+			*/
+			RFK_NODISCARD static inline std::size_t	getIdealSlotIndex(std::size_t id,
+																	  std::size_t mask)		noexcept;
+
+			/**
+			*	@brief Reallocate the slots array to the provided number of slots and reinsert all entities.
+			* 
+			*	@param slotsCount New number of slots. Must be a power of 2 and big enough to contain all registered entities.
+			*/
+			inline void								rehash(std::size_t slotsCount)				noexcept;
+
+		public:
+			EntityIdIndex()									= default;
+			EntityIdIndex(EntityIdIndex const&)				= default;
+			EntityIdIndex(EntityIdIndex&&)					= default;
+			~EntityIdIndex()								= default;
+
+			/**
+			*	@brief	Insert an entity in the index.
+			*			If an entity with the same id is already contained in the index, the index is left unchanged.
+			* 
+			*	@param entity The entity to insert.
+			* 
+			*	@return A pair containing the entity stored for the provided entity id, and a bool set to true if the insertion happened.
+			*/
+			inline std::pair<Entity const*, bool>	emplace(Entity const* entity)				noexcept;
+
+			/**
+			*	@brief	Remove an entity from the index.
+			*			The entity is removed only if it is the entity stored for its id.
+			* 
+			*	@param entity The entity to remove.
+			* 
+			*	@return true if the entity was removed, else false.
+			*/
+			inline bool								erase(Entity const* entity)					noexcept;
+
+			/**
+			*	@brief Find the entity registered with the provided id.
+			* 
+			*	@param id The id of the searched entity.
+			* 
+			*	@return The entity registered with the provided id if any, else nullptr.
+			*/
+			RFK_NODISCARD inline Entity const*		find(std::size_t id)				const	noexcept;
+
+			/**
+			*	@brief Make sure the index can contain at least the provided number of entities without reallocating.
+			* 
+			*	@param capacity Number of entities the index should be able to contain.
+			*/
+			inline void								reserve(std::size_t capacity)				noexcept;
+
+			/**
+			*	@brief Remove all entities from the index. The allocated slots are kept.
+			*/
+			inline void								clear()										noexcept;
+
+			/**
+			*	@brief Get the number of entities contained in the index.
+			* 
+			*	@return The number of entities contained in the index.
+			*/
+			RFK_NODISCARD inline std::size_t		size()								const	noexcept;
+
+			EntityIdIndex& operator=(EntityIdIndex const&)	= default;
+			EntityIdIndex& operator=(EntityIdIndex&&)		= default;
+	};
+
+	#include "Refureku/TypeInfo/Entity/EntityIdIndex.inl"
+}
@@ -0,0 +1,172 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline std::size_t EntityIdIndex::getIdealSlotIndex(std::size_t id, std::size_t mask) noexcept
+{
+	//Murmur3 finalizer
+	std::uint64_t hash = static_cast<std::uint64_t>(id);
+
+	hash ^= hash >> 33u;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33u;
+
+	return static_cast<std::size_t>(hash) & mask;
+}
+
+inline void EntityIdIndex::rehash(std::size_t slotsCount) noexcept
+{
+	assert((slotsCount & (slotsCount - 1u)) == 0u);
+	assert(slotsCount > _size);
+
+	std::vector<Slot> oldSlots(slotsCount);
+	oldSlots.swap(_slots);
+
+	std::size_t const mask = _slots.size() - 1u;
+
+	for (Slot const& slot : oldSlots)
+	{
+		if (slot.entity != nullptr)
+		{
+			std::size_t index = getIdealSlotIndex(slot.id, mask);
+
+			while (_slots[index].entity != nullptr)
+			{
+				index = (index + 1u) & mask;
+			}
+
+			_slots[index] = slot;
+		}
+	}
+}
+
+inline std::pair<Entity const*, bool> EntityIdIndex::emplace(Entity const* entity) noexcept
+{
+	assert(entity != nullptr);
+
+	//Keep the load factor <= 0.5 so that probe sequences stay short
+	if ((_size + 1u) * 2u > _slots.size())
+	{
+		rehash(_slots.empty() ? _minCapacity : _slots.size() * 2u);
+	}
+
+	std::size_t const	id		= entity->getId();
+	std::size_t const	mask	= _slots.size() - 1u;
+	std::size_t			index	= getIdealSlotIndex(id, mask);
+
+	while (_slots[index].entity != nullptr)
+	{
+		if (_slots[index].id == id)
+		{
+			return std::make_pair(_slots[index].entity, false);
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	_slots[index].id		= id;
+	_slots[index].entity	= entity;
+	_size++;
+
+	return std::make_pair(entity, true);
+}
+
+inline bool EntityIdIndex::erase(Entity const* entity) noexcept
+{
+	if (_size == 0u)
+	{
+		return false;
+	}
+
+	std::size_t const	mask	= _slots.size() - 1u;
+	std::size_t			index	= getIdealSlotIndex(entity->getId(), mask);
+
+	while (_slots[index].entity != entity)
+	{
+		if (_slots[index].entity == nullptr)
+		{
+			//Entity not found
+			return false;
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	//Backward shift deletion: move back the following entries of the cluster which are not at their ideal slot
+	std::size_t next = (index + 1u) & mask;
+
+	while (_slots[next].entity != nullptr)
+	{
+		std::size_t ideal = getIdealSlotIndex(_slots[next].id, mask);
+
+		//Move the entry only if the freed slot is (cyclically) between its ideal slot and its current slot
+		if (((next - ideal) & mask) >= ((next - index) & mask))
+		{
+			_slots[index] = _slots[next];
+			index = next;
+		}
+
+		next = (next + 1u) & mask;
+	}
+
+	_slots[index] = Slot();
+	_size--;
+
+	return true;
+}
+
+inline Entity const* EntityIdIndex::find(std::size_t id) const noexcept
+{
+	if (_size == 0u)
+	{
+		return nullptr;
+	}
+
+	std::size_t const	mask	= _slots.size() - 1u;
+	std::size_t			index	= getIdealSlotIndex(id, mask);
+
+	while (_slots[index].entity != nullptr)
+	{
+		if (_slots[index].id == id)
+		{
+			return _slots[index].entity;
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	return nullptr;
+}
+
+inline void EntityIdIndex::reserve(std::size_t capacity) noexcept
+{
+	std::size_t slotsCount = _minCapacity;
+
+	while (slotsCount < capacity * 2u)
+	{
+		slotsCount *= 2u;
+	}
+
+	if (slotsCount > _slots.size())
+	{
+		rehash(slotsCount);
+	}
+}
+
+inline void EntityIdIndex::clear() noexcept
+{
+	for (Slot& slot : _slots)
+	{
+		slot = Slot();
+	}
+
+	_size = 0u;
+}
+
+inline std::size_t EntityIdIndex::size() const noexcept
+{
+	return _size;
+}
@@ -8,24 +8,77 @@
 #pragma once
 
 #include <cstddef>	//std::size_t
-#include <string>
+#include <cstring>	//std::memcpy
+#include <atomic>
+#include <bitset>	//std::bitset::count
+#include <limits>	//std::numeric_limits
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
 #include "Refureku/Properties/Property.h"
+#include "Refureku/Misc/MetadataArena.h"
 
 namespace rfk
 {
 	class Entity::EntityImpl
 	{
 		private:
-			/** Name qualifying this entity. */
-			std::string						_name;
+			struct PropertiesOfArchetype
+			{
+				/** First attached property whose archetype is exactly the indexed archetype, nullptr if none. */
+				Property const*	exactMatch	= nullptr;
+
+				/** First attached property whose archetype is the indexed archetype or one of its subclasses. */
+				Property const*	firstMatch	= nullptr;
+			};
+
+			/** Value of _propertyArchetypeIndex for entities which have not been given a property archetype index yet. */
+			static constexpr uint32	_invalidPropertyArchetypeIndex = std::numeric_limits<uint32>::max();
+
+			/** Next property archetype index to give to an entity. */
+			inline static std::atomic<uint32>	_nextPropertyArchetypeIndex = 0u;
+
+			/**
+			*	Property archetype index given to each archetype id.
+			*	An archetype reloaded with the same id (when its module is reloaded) gets back its previous index,
+			*	so property archetype masks don't grow with every reload.
+			*/
+			struct PropertyArchetypeIndexById
+			{
+				std::unordered_map<std::size_t, uint32>	indices;
+				std::mutex								mutex;
+			};
+
+			/**
+			*	Null-terminated name qualifying this entity.
+			*	It points to the registered string literal if the name is static, else to a copy owned by this entity.
+			*/
+			char const*						_name;
+
+			/** Length of _name, null terminator excluded. */
+			std::size_t						_nameLength;
+
+			/** Hash of _name, computed once to speed up name-keyed containers. */
+			std::size_t						_nameHash;
 
 			/** Properties attached to this entity. */
 			std::vector<Property const*>	_properties;
 
+			/**
+			*	Bit i is set if a property whose archetype is, or inherits from, the archetype of property archetype index i is attached to this entity.
+			*	Each set bit has an entry in _propertiesByArchetype, located at the rank of the bit (the number of set bits before it).
+			*/
+			std::vector<uint64>					_propertyArchetypesMask;
+
+			/** Attached properties matching each archetype set in _propertyArchetypesMask, ordered by property archetype index. */
+			std::vector<PropertiesOfArchetype>	_propertiesByArchetype;
+
 			/** Program-unique ID given for this entity. The ID is persistent even after the program is recompiled / relaunched. */
 			std::size_t						_id;
 
@@ -38,12 +91,85 @@ namespace rfk
 			/** Kind of this entity. */
 			EEntityKind						_kind;
 
+			/** Is _name a copy owned by this entity? */
+			bool							_ownsName;
+
+			/**
+			*	Compact index of this entity when it is used as a property archetype, or one of its parents.
+			*	Indices are given on demand when a property is attached, so they stay small and can be used as bit positions.
+			*/
+			mutable std::atomic<uint32>		_propertyArchetypeIndex;
+
+			/**
+			*	@brief	Get the property archetype index of an archetype, giving it one if it has none yet.
+			*			Archetypes sharing the same non-zero id share the same index.
+			* 
+			*	@param archetype The archetype to get the index of.
+			* 
+			*	@return The property archetype index of archetype.
+			*/
+			inline static uint32						getOrCreatePropertyArchetypeIndex(Struct const& archetype)		noexcept;
+
+			/**
+			*	@brief	Get the property archetype indices given to archetype ids.
+			*			The registry is never destroyed since properties can be attached during any module static initialization.
+			* 
+			*	@return The property archetype indices given to archetype ids.
+			*/
+			inline static PropertyArchetypeIndexById&	getPropertyArchetypeIndexById()									noexcept;
+
+			/**
+			*	@brief	Count the bits set in _propertyArchetypesMask before the bit of a property archetype index.
+			*			The word containing the bit must be in _propertyArchetypesMask.
+			* 
+			*	@param propertyArchetypeIndex The property archetype index to compute the rank of.
+			* 
+			*	@return The number of bits set before the bit of propertyArchetypeIndex.
+			*/
+			inline std::size_t							computePropertyArchetypeRank(uint32 propertyArchetypeIndex)	const	noexcept;
+
+			/**
+			*	@brief Get the entry of _propertiesByArchetype matching a property archetype index.
+			* 
+			*	@param propertyArchetypeIndex The property archetype index to look for.
+			* 
+			*	@return The entry matching the provided index if its bit is set in _propertyArchetypesMask, else nullptr.
+			*/
+			inline PropertiesOfArchetype const*			findPropertiesOfArchetype(uint32 propertyArchetypeIndex)	const	noexcept;
+
+			/**
+			*	@brief Get the entry of _propertiesByArchetype matching a property archetype index, creating it if needed.
+			* 
+			*	@param propertyArchetypeIndex The property archetype index to look for.
+			* 
+			*	@return The entry matching the provided index.
+			*/
+			inline PropertiesOfArchetype&				getOrCreatePropertiesOfArchetype(uint32 propertyArchetypeIndex)			noexcept;
+
+			/**
+			*	@brief Index a newly attached property under its archetype and all the reflected parents of the archetype, recursively.
+			* 
+			*	@param property		The attached property.
+			*	@param archetype	Archetype to index the property under.
+			*	@param isExactMatch	Is archetype the archetype of the property?
+			*/
+			inline void									indexProperty(Property const&	property,
+																	  Struct const&		archetype,
+																	  bool				isExactMatch)					noexcept;
+
 		public:
-			inline EntityImpl(char const*		name,
+			inline EntityImpl(EntityName		name,
 							  std::size_t		id,
 							  EEntityKind		kind = EEntityKind::Undefined,
 							  Entity const*	outerEntity = nullptr)				noexcept;
-			virtual ~EntityImpl()												= default;
+			EntityImpl(EntityImpl const&)										= delete;
+			inline virtual ~EntityImpl()										noexcept;
+
+			/**
+			*	All entities implementations derive from EntityImpl, so they are all allocated from the current MetadataArena if any.
+			*/
+			inline static void*	operator new(std::size_t size);
+			inline static void	operator delete(void* ptr)							noexcept;
 
 			/**
 			*	@brief Add a property to this entity.
@@ -55,6 +181,18 @@ namespace rfk
 			*/
 			inline bool									addProperty(Property const& property)					noexcept;
 
+			/**
+			*	@brief	Retrieve the first property matching with the provided archetype.
+			*			The lookup is a bit test followed by an indexed load.
+			*	
+			*	@param archetype			Archetype of the property to look for.
+			*	@param isChildClassValid	If true, consider properties inheriting from the provided archetype valid.
+			* 
+			*	@return The first property matching the provided archetype in this entity, nullptr if none is found.
+			*/
+			inline Property const*						getProperty(Struct const&	archetype,
+																	bool			isChildClassValid)			const	noexcept;
+
 			/**
 			*	@brief Inherit from another entity inheritable properties.
 			*	
@@ -74,7 +212,14 @@ namespace rfk
 			* 
 			*	@return _name.
 			*/
-			inline std::string const&					getName()										const	noexcept;
+			inline std::string_view						getName()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _nameHash.
+			* 
+			*	@return _nameHash.
+			*/
+			inline std::size_t							getNameHash()									const	noexcept;
 
 			/**
 			*	@brief Getter for the field _id.
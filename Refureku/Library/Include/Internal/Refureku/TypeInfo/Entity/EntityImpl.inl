@@ -5,35 +5,208 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Entity::EntityImpl::EntityImpl(char const* name, std::size_t id, EEntityKind kind, Entity const* outerEntity) noexcept:
-	_name{name},
+inline Entity::EntityImpl::EntityImpl(EntityName name, std::size_t id, EEntityKind kind, Entity const* outerEntity) noexcept:
+	_name{name.getData()},
+	_nameLength{name.getLength()},
+	_nameHash{std::hash<std::string_view>()(std::string_view(_name, _nameLength))},
 	_properties{},
+	_propertyArchetypesMask{},
+	_propertiesByArchetype{},
 	_id{id},
 	_outerEntity{outerEntity},
-	_kind{kind}
+	_kind{kind},
+	_ownsName{!name.isStatic()},
+	_propertyArchetypeIndex{_invalidPropertyArchetypeIndex}
 {
+	if (_ownsName)
+	{
+		//Dynamic names may not outlive the entity, so copy them
+		char* nameCopy = static_cast<char*>(internal::allocateMetadata(_nameLength + 1u));
+
+		if (_nameLength != 0u)
+		{
+			std::memcpy(nameCopy, name.getData(), _nameLength);
+		}
+		nameCopy[_nameLength] = '\0';
+
+		_name = nameCopy;
+	}
+}
+
+inline Entity::EntityImpl::~EntityImpl() noexcept
+{
+	if (_ownsName)
+	{
+		internal::deallocateMetadata(const_cast<char*>(_name));
+	}
+}
+
+inline void* Entity::EntityImpl::operator new(std::size_t size)
+{
+	return internal::allocateMetadata(size);
+}
+
+inline void Entity::EntityImpl::operator delete(void* ptr) noexcept
+{
+	internal::deallocateMetadata(ptr);
+}
+
+inline uint32 Entity::EntityImpl::getOrCreatePropertyArchetypeIndex(Struct const& archetype) noexcept
+{
+	std::atomic<uint32>&	archetypeIndex	= static_cast<Entity const&>(archetype).getPimpl()->_propertyArchetypeIndex;
+	uint32					index			= archetypeIndex.load(std::memory_order_acquire);
+
+	if (index == _invalidPropertyArchetypeIndex)
+	{
+		std::size_t	archetypeId = archetype.getId();
+		uint32		newIndex;
+
+		if (archetypeId != 0u)
+		{
+			//Key the index by the archetype id, which is stable across module reloads
+			PropertyArchetypeIndexById&	indexById = getPropertyArchetypeIndexById();
+			std::lock_guard<std::mutex>	lock(indexById.mutex);
+
+			auto [it, inserted] = indexById.indices.try_emplace(archetypeId, _invalidPropertyArchetypeIndex);
+
+			if (inserted)
+			{
+				it->second = _nextPropertyArchetypeIndex.fetch_add(1u, std::memory_order_relaxed);
+			}
+
+			newIndex = it->second;
+		}
+		else
+		{
+			//Archetypes without id can't be told apart, so they all get a new index
+			newIndex = _nextPropertyArchetypeIndex.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		//If another thread gave an index to the archetype in the meantime, keep it (newIndex is lost if it was not shared)
+		index = archetypeIndex.compare_exchange_strong(index, newIndex, std::memory_order_acq_rel) ? newIndex : index;
+	}
+
+	return index;
+}
+
+inline Entity::EntityImpl::PropertyArchetypeIndexById& Entity::EntityImpl::getPropertyArchetypeIndexById() noexcept
+{
+	static PropertyArchetypeIndexById* instance = new PropertyArchetypeIndexById();
+
+	return *instance;
+}
+
+inline std::size_t Entity::EntityImpl::computePropertyArchetypeRank(uint32 propertyArchetypeIndex) const noexcept
+{
+	std::size_t	wordIndex	= propertyArchetypeIndex / 64u;
+	std::size_t	rank		= std::bitset<64>(_propertyArchetypesMask[wordIndex] & ((uint64(1u) << (propertyArchetypeIndex % 64u)) - 1u)).count();
+
+	for (std::size_t i = 0u; i < wordIndex; i++)
+	{
+		rank += std::bitset<64>(_propertyArchetypesMask[i]).count();
+	}
+
+	return rank;
+}
+
+inline Entity::EntityImpl::PropertiesOfArchetype const* Entity::EntityImpl::findPropertiesOfArchetype(uint32 propertyArchetypeIndex) const noexcept
+{
+	std::size_t	wordIndex	= propertyArchetypeIndex / 64u;
+	uint64		bit			= uint64(1u) << (propertyArchetypeIndex % 64u);
+
+	if (wordIndex >= _propertyArchetypesMask.size() || (_propertyArchetypesMask[wordIndex] & bit) == 0u)
+	{
+		return nullptr;
+	}
+
+	//The entry is located at the rank of the bit in the mask
+	return &_propertiesByArchetype[computePropertyArchetypeRank(propertyArchetypeIndex)];
+}
+
+inline Entity::EntityImpl::PropertiesOfArchetype& Entity::EntityImpl::getOrCreatePropertiesOfArchetype(uint32 propertyArchetypeIndex) noexcept
+{
+	PropertiesOfArchetype const* entry = findPropertiesOfArchetype(propertyArchetypeIndex);
+
+	if (entry != nullptr)
+	{
+		return const_cast<PropertiesOfArchetype&>(*entry);
+	}
+
+	std::size_t	wordIndex	= propertyArchetypeIndex / 64u;
+	uint64		bit			= uint64(1u) << (propertyArchetypeIndex % 64u);
+
+	if (wordIndex >= _propertyArchetypesMask.size())
+	{
+		_propertyArchetypesMask.resize(wordIndex + 1u, 0u);
+	}
+
+	_propertyArchetypesMask[wordIndex] |= bit;
+
+	//Insert the new entry at the rank of its bit to keep entries ordered by property archetype index
+	return *_propertiesByArchetype.emplace(_propertiesByArchetype.cbegin() + computePropertyArchetypeRank(propertyArchetypeIndex));
+}
+
+inline void Entity::EntityImpl::indexProperty(Property const& property, Struct const& archetype, bool isExactMatch) noexcept
+{
+	PropertiesOfArchetype& entry = getOrCreatePropertiesOfArchetype(getOrCreatePropertyArchetypeIndex(archetype));
+
+	//Properties are appended, so only the first indexed property of each archetype must be kept
+	if (isExactMatch && entry.exactMatch == nullptr)
+	{
+		entry.exactMatch = &property;
+	}
+
+	if (entry.firstMatch == nullptr)
+	{
+		entry.firstMatch = &property;
+	}
+
+	for (std::size_t i = 0u; i < archetype.getDirectParentsCount(); i++)
+	{
+		indexProperty(property, archetype.getDirectParentAt(i).getArchetype(), false);
+	}
 }
 
 inline bool Entity::EntityImpl::addProperty(Property const& toAddProperty) noexcept
 {
+	Struct const& archetype = toAddProperty.getArchetype();
+
 	if (!toAddProperty.getAllowMultiple())
 	{
 		//Check if a property of the same type is already in this entity,
 		//in which case we abort the add
-		for (Property const* property : _properties)
+		if (getProperty(archetype, false) != nullptr)
 		{
-			if (&toAddProperty.getArchetype() == &property->getArchetype())
-			{
-				return false;
-			}
+			return false;
 		}
 	}
 
 	_properties.push_back(&toAddProperty);
+	indexProperty(toAddProperty, archetype, true);
 
 	return true;
 }
 
+inline Property const* Entity::EntityImpl::getProperty(Struct const& archetype, bool isChildClassValid) const noexcept
+{
+	uint32 archetypeIndex = static_cast<Entity const&>(archetype).getPimpl()->_propertyArchetypeIndex.load(std::memory_order_acquire);
+
+	//An archetype without index has never been attached to any entity
+	if (archetypeIndex == _invalidPropertyArchetypeIndex)
+	{
+		return nullptr;
+	}
+
+	PropertiesOfArchetype const* entry = findPropertiesOfArchetype(archetypeIndex);
+
+	if (entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	return isChildClassValid ? entry->firstMatch : entry->exactMatch;
+}
+
 inline void Entity::EntityImpl::inheritProperties(EntityImpl const& from) noexcept
 {
 	for (Property const* property : from._properties)
@@ -53,9 +226,14 @@ inline void Entity::EntityImpl::inheritAllProperties(EntityImpl const& from) noe
 	}
 }
 
-inline std::string const& Entity::EntityImpl::getName() const noexcept
+inline std::string_view Entity::EntityImpl::getName() const noexcept
+{
+	return std::string_view(_name, _nameLength);
+}
+
+inline std::size_t Entity::EntityImpl::getNameHash() const noexcept
 {
-	return _name;
+	return _nameHash;
 }
 
 inline std::size_t Entity::EntityImpl::getId() const noexcept
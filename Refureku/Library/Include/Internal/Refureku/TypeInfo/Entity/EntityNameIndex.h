@@ -0,0 +1,192 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <cstdint>		//std::uint64_t
+#include <iterator>		//std::forward_iterator_tag
+#include <string_view>
+#include <type_traits>
+#include <utility>		//std::pair
+#include <vector>
+#include <cassert>
+
+#include "Refureku/TypeInfo/Entity/Entity.h"
+
+namespace rfk
+{
+	/**
+	*	Flat open-addressing hash index of entity pointers keyed by entity name.
+	*	Slots store the precomputed entity name hash next to the entity pointer, so probing only dereferences
+	*	an entity when its name hash matches the searched one.
+	*	Entities can be searched by std::string_view without constructing any temporary entity or string.
+	*
+	*	@tparam T					Entity type stored in the index.
+	*	@tparam AllowDuplicateNames	If true, multiple entities with the same name can be stored in the index (overloaded functions for example).
+	*/
+	template <typename T, bool AllowDuplicateNames = false>
+	class EntityNameIndex final
+	{
+		private:
+			struct Slot
+			{
+				/** Name hash of the entity stored in this slot. Only meaningful if entity is not nullptr. */
+				std::size_t	nameHash	= 0u;
+
+				/** Entity stored in this slot, nullptr if the slot is empty. */
+				T const*	entity		= nullptr;
+			};
+
+		public:
+			using value_type = T const*;
+
+			class const_iterator
+			{
+				private:
+					/** Current slot. */
+					Slot const*	_current;
+
+					/** Past-the-end slot. */
+					Slot const*	_end;
+
+					/**
+					*	@brief Move _current to the first non-empty slot starting at _current.
+					*/
+					inline void	skipEmptySlots()	noexcept;
+
+				public:
+					using iterator_category	= std::forward_iterator_tag;
+					using value_type		= T const*;
+					using difference_type	= std::ptrdiff_t;
+					using pointer			= T const* const*;
+					using reference			= T const* const&;
+
+					inline const_iterator(Slot const* current,
+										  Slot const* end)					noexcept;
+
+					inline reference		operator*()				const	noexcept;
+					inline const_iterator&	operator++()					noexcept;
+					inline const_iterator	operator++(int)					noexcept;
+					inline bool				operator==(const_iterator const& other)	const	noexcept;
+					inline bool				operator!=(const_iterator const& other)	const	noexcept;
+			};
+
+		private:
+			/** Minimum number of slots allocated when the first entity is inserted. Must be a power of 2. */
+			static constexpr std::size_t	_minCapacity = 16u;
+
+			/** Slots of the index. The size of this vector is always 0 or a power of 2. */
+			std::vector<Slot>	_slots;
+
+			/** Number of non-empty slots. */
+			std::size_t			_size = 0u;
+
+			/**
+			*	@brief Compute the preferred slot index of a name hash.
+			* 
+			*	@param nameHash	Name hash to compute the slot of.
+			*	@param mask		Slots count - 1.
+			* 
+			*	@return The index of the slot the name hash should ideally be stored in.
+			*/
+			RFK_NODISCARD static inline std::size_t	getIdealSlotIndex(std::size_t nameHash,
+																	  std::size_t mask)				noexcept;
+
+			/**
+			*	@brief Reallocate the slots array to the provided number of slots and reinsert all entities.
+			* 
+			*	@param slotsCount New number of slots. Must be a power of 2 and big enough to contain all entities.
+			*/
+			inline void								rehash(std::size_t slotsCount)						noexcept;
+
+		public:
+			EntityNameIndex()									= default;
+			EntityNameIndex(EntityNameIndex const&)				= default;
+			EntityNameIndex(EntityNameIndex&&)					= default;
+			~EntityNameIndex()									= default;
+
+			/**
+			*	@brief	Insert an entity in the index.
+			*			If AllowDuplicateNames is false and an entity with the same name is already contained in the index,
+			*			the index is left unchanged. The same entity is never inserted twice.
+			* 
+			*	@param entity The entity to insert.
+			* 
+			*	@return A pair containing the inserted entity (or the entity preventing the insertion), and a bool set to true if the insertion happened.
+			*/
+			inline std::pair<T const*, bool>		emplace(T const* entity)							noexcept;
+
+			/**
+			*	@brief Remove an entity from the index.
+			* 
+			*	@param entity The entity to remove.
+			* 
+			*	@return true if the entity was removed, else false.
+			*/
+			inline bool								erase(T const* entity)								noexcept;
+
+			/**
+			*	@brief Find an entity by name.
+			* 
+			*	@param name The name of the searched entity.
+			* 
+			*	@return The first found entity with the provided name if any, else nullptr.
+			*/
+			RFK_NODISCARD inline T const*			find(std::string_view name)					const	noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all entities with the provided name.
+			* 
+			*	@param name		The name of the visited entities.
+			*	@param visitor	Visitor to execute, with the signature bool(T const&). Return false to abort the loop.
+			* 
+			*	@return The last visitor result before exiting the loop, true if no entity was visited.
+			*/
+			template <typename Visitor>
+			bool									foreachNamed(std::string_view	name,
+																 Visitor			visitor)	const;
+
+			/**
+			*	@brief Make sure the index can contain at least the provided number of entities without reallocating.
+			* 
+			*	@param capacity Number of entities the index should be able to contain.
+			*/
+			inline void								reserve(std::size_t capacity)						noexcept;
+
+			/**
+			*	@brief Get the number of entities contained in the index.
+			* 
+			*	@return The number of entities contained in the index.
+			*/
+			RFK_NODISCARD inline std::size_t		size()										const	noexcept;
+
+			/**
+			*	@brief Check whether the index contains no entity.
+			* 
+			*	@return true if the index contains no entity, else false.
+			*/
+			RFK_NODISCARD inline bool				empty()										const	noexcept;
+
+			RFK_NODISCARD inline const_iterator	begin()										const	noexcept;
+			RFK_NODISCARD inline const_iterator	end()										const	noexcept;
+			RFK_NODISCARD inline const_iterator	cbegin()									const	noexcept;
+			RFK_NODISCARD inline const_iterator	cend()										const	noexcept;
+
+			EntityNameIndex& operator=(EntityNameIndex const&)	= default;
+			EntityNameIndex& operator=(EntityNameIndex&&)		= default;
+	};
+
+	/** Check whether a container type is an EntityNameIndex. */
+	template <typename T>
+	struct IsEntityNameIndex : std::false_type {};
+
+	template <typename T, bool AllowDuplicateNames>
+	struct IsEntityNameIndex<EntityNameIndex<T, AllowDuplicateNames>> : std::true_type {};
+
+	#include "Refureku/TypeInfo/Entity/EntityNameIndex.inl"
+}
@@ -0,0 +1,275 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T, bool AllowDuplicateNames>
+inline EntityNameIndex<T, AllowDuplicateNames>::const_iterator::const_iterator(Slot const* current, Slot const* end) noexcept:
+	_current{current},
+	_end{end}
+{
+	skipEmptySlots();
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline void EntityNameIndex<T, AllowDuplicateNames>::const_iterator::skipEmptySlots() noexcept
+{
+	while (_current != _end && _current->entity == nullptr)
+	{
+		_current++;
+	}
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator::reference EntityNameIndex<T, AllowDuplicateNames>::const_iterator::operator*() const noexcept
+{
+	return _current->entity;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator& EntityNameIndex<T, AllowDuplicateNames>::const_iterator::operator++() noexcept
+{
+	_current++;
+	skipEmptySlots();
+
+	return *this;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator EntityNameIndex<T, AllowDuplicateNames>::const_iterator::operator++(int) noexcept
+{
+	const_iterator result = *this;
+
+	++(*this);
+
+	return result;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline bool EntityNameIndex<T, AllowDuplicateNames>::const_iterator::operator==(const_iterator const& other) const noexcept
+{
+	return _current == other._current;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline bool EntityNameIndex<T, AllowDuplicateNames>::const_iterator::operator!=(const_iterator const& other) const noexcept
+{
+	return _current != other._current;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline std::size_t EntityNameIndex<T, AllowDuplicateNames>::getIdealSlotIndex(std::size_t nameHash, std::size_t mask) noexcept
+{
+	//Murmur3 finalizer, in case the name hash function leaves low bits poorly distributed
+	std::uint64_t hash = static_cast<std::uint64_t>(nameHash);
+
+	hash ^= hash >> 33u;
+	hash *= 0xff51afd7ed558ccdull;
+	hash ^= hash >> 33u;
+
+	return static_cast<std::size_t>(hash) & mask;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline void EntityNameIndex<T, AllowDuplicateNames>::rehash(std::size_t slotsCount) noexcept
+{
+	assert((slotsCount & (slotsCount - 1u)) == 0u);
+	assert(slotsCount > _size);
+
+	std::vector<Slot> oldSlots(slotsCount);
+	oldSlots.swap(_slots);
+
+	std::size_t const mask = _slots.size() - 1u;
+
+	for (Slot const& slot : oldSlots)
+	{
+		if (slot.entity != nullptr)
+		{
+			std::size_t index = getIdealSlotIndex(slot.nameHash, mask);
+
+			while (_slots[index].entity != nullptr)
+			{
+				index = (index + 1u) & mask;
+			}
+
+			_slots[index] = slot;
+		}
+	}
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline std::pair<T const*, bool> EntityNameIndex<T, AllowDuplicateNames>::emplace(T const* entity) noexcept
+{
+	assert(entity != nullptr);
+
+	//Keep the load factor <= 0.5 so that probe sequences stay short
+	if ((_size + 1u) * 2u > _slots.size())
+	{
+		rehash(_slots.empty() ? _minCapacity : _slots.size() * 2u);
+	}
+
+	std::size_t const		nameHash	= entity->getNameHash();
+	std::string_view const	name		= entity->getName();
+	std::size_t const		mask		= _slots.size() - 1u;
+	std::size_t				index		= getIdealSlotIndex(nameHash, mask);
+
+	while (_slots[index].entity != nullptr)
+	{
+		if (_slots[index].entity == entity ||
+			(!AllowDuplicateNames && _slots[index].nameHash == nameHash && name == _slots[index].entity->getName()))
+		{
+			return std::make_pair(_slots[index].entity, false);
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	_slots[index].nameHash	= nameHash;
+	_slots[index].entity	= entity;
+	_size++;
+
+	return std::make_pair(entity, true);
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline bool EntityNameIndex<T, AllowDuplicateNames>::erase(T const* entity) noexcept
+{
+	if (_size == 0u)
+	{
+		return false;
+	}
+
+	std::size_t const	mask	= _slots.size() - 1u;
+	std::size_t			index	= getIdealSlotIndex(entity->getNameHash(), mask);
+
+	while (_slots[index].entity != entity)
+	{
+		if (_slots[index].entity == nullptr)
+		{
+			//Entity not found
+			return false;
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	//Backward shift deletion: move back the following entries of the cluster which are not at their ideal slot
+	std::size_t next = (index + 1u) & mask;
+
+	while (_slots[next].entity != nullptr)
+	{
+		std::size_t ideal = getIdealSlotIndex(_slots[next].nameHash, mask);
+
+		//Move the entry only if the freed slot is (cyclically) between its ideal slot and its current slot
+		if (((next - ideal) & mask) >= ((next - index) & mask))
+		{
+			_slots[index] = _slots[next];
+			index = next;
+		}
+
+		next = (next + 1u) & mask;
+	}
+
+	_slots[index] = Slot();
+	_size--;
+
+	return true;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline T const* EntityNameIndex<T, AllowDuplicateNames>::find(std::string_view name) const noexcept
+{
+	T const* result = nullptr;
+
+	foreachNamed(name, [&result](T const& entity) noexcept
+				 {
+					 result = &entity;
+
+					 return false;
+				 });
+
+	return result;
+}
+
+template <typename T, bool AllowDuplicateNames>
+template <typename Visitor>
+bool EntityNameIndex<T, AllowDuplicateNames>::foreachNamed(std::string_view name, Visitor visitor) const
+{
+	if (_size == 0u)
+	{
+		return true;
+	}
+
+	std::size_t const	nameHash	= std::hash<std::string_view>()(name);
+	std::size_t const	mask		= _slots.size() - 1u;
+	std::size_t			index		= getIdealSlotIndex(nameHash, mask);
+
+	while (_slots[index].entity != nullptr)
+	{
+		if (_slots[index].nameHash == nameHash && name == _slots[index].entity->getName())
+		{
+			if (!visitor(*_slots[index].entity))
+			{
+				return false;
+			}
+		}
+
+		index = (index + 1u) & mask;
+	}
+
+	return true;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline void EntityNameIndex<T, AllowDuplicateNames>::reserve(std::size_t capacity) noexcept
+{
+	std::size_t slotsCount = _minCapacity;
+
+	while (slotsCount < capacity * 2u)
+	{
+		slotsCount *= 2u;
+	}
+
+	if (slotsCount > _slots.size())
+	{
+		rehash(slotsCount);
+	}
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline std::size_t EntityNameIndex<T, AllowDuplicateNames>::size() const noexcept
+{
+	return _size;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline bool EntityNameIndex<T, AllowDuplicateNames>::empty() const noexcept
+{
+	return _size == 0u;
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator EntityNameIndex<T, AllowDuplicateNames>::begin() const noexcept
+{
+	return const_iterator(_slots.data(), _slots.data() + _slots.size());
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator EntityNameIndex<T, AllowDuplicateNames>::end() const noexcept
+{
+	return const_iterator(_slots.data() + _slots.size(), _slots.data() + _slots.size());
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator EntityNameIndex<T, AllowDuplicateNames>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template <typename T, bool AllowDuplicateNames>
+inline typename EntityNameIndex<T, AllowDuplicateNames>::const_iterator EntityNameIndex<T, AllowDuplicateNames>::cend() const noexcept
+{
+	return end();
+}
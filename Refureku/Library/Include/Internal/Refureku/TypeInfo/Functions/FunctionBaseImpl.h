@@ -23,10 +23,13 @@ namespace rfk
 			UniquePtr<ICallable>			_internalFunction;
 
 			/** Parameters of this function. */
-			std::vector<FunctionParameter>	_parameters;
+			std::vector<FunctionParameter, internal::MetadataAllocator<FunctionParameter>>	_parameters;
+
+			/** Fingerprint of the return type and parameter types of this function. */
+			uint64							_signatureFingerprint;
 
 		public:
-			inline FunctionBaseImpl(char const*		name, 
+			inline FunctionBaseImpl(EntityName		name, 
 									std::size_t		id,
 									EEntityKind		kind,
 									Type const&		returnType,
@@ -43,7 +46,7 @@ namespace rfk
 			*	
 			*	@return The added function parameter.
 			*/
-			inline FunctionParameter&									addParameter(char const*				name,
+			inline FunctionParameter&									addParameter(EntityName				name,
 																						 std::size_t			id,
 																						 Type const&			type,
 																						 FunctionBase const*	outerEntity)	noexcept;
@@ -67,7 +70,14 @@ namespace rfk
 			* 
 			*	@return _parameters.
 			*/
-			RFK_NODISCARD inline std::vector<FunctionParameter> const&	getParameters()									const	noexcept;
+			RFK_NODISCARD inline std::vector<FunctionParameter, internal::MetadataAllocator<FunctionParameter>> const&	getParameters()									const	noexcept;
+
+			/**
+			*	@brief Getter for the field _signatureFingerprint.
+			* 
+			*	@return _signatureFingerprint.
+			*/
+			RFK_NODISCARD inline uint64									getSignatureFingerprint()						const	noexcept;
 
 			/**
 			*	@brief Set the _parameters vector capacity.
@@ -5,16 +5,19 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline FunctionBase::FunctionBaseImpl::FunctionBaseImpl(char const* name, std::size_t id, EEntityKind kind,
+inline FunctionBase::FunctionBaseImpl::FunctionBaseImpl(EntityName name, std::size_t id, EEntityKind kind,
 														   Type const& returnType, ICallable* internalFunction, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, kind, outerEntity),
 	_returnType{returnType},
-	_internalFunction{internalFunction}
+	_internalFunction{internalFunction},
+	_signatureFingerprint{FunctionBase::combineSignatureFingerprint(FunctionBase::_signatureFingerprintSeed, returnType)}
 {
 }
 
-inline FunctionParameter& FunctionBase::FunctionBaseImpl::addParameter(char const* name, std::size_t id, Type const& type, FunctionBase const* outerEntity) noexcept
+inline FunctionParameter& FunctionBase::FunctionBaseImpl::addParameter(EntityName name, std::size_t id, Type const& type, FunctionBase const* outerEntity) noexcept
 {
+	_signatureFingerprint = FunctionBase::combineSignatureFingerprint(_signatureFingerprint, type);
+
 	return _parameters.emplace_back(name, id, type, outerEntity);
 }
 
@@ -28,11 +31,16 @@ inline ICallable* FunctionBase::FunctionBaseImpl::getInternalFunction() const no
 	return _internalFunction.get();
 }
 
-inline std::vector<FunctionParameter> const& FunctionBase::FunctionBaseImpl::getParameters() const noexcept
+inline std::vector<FunctionParameter, internal::MetadataAllocator<FunctionParameter>> const& FunctionBase::FunctionBaseImpl::getParameters() const noexcept
 {
 	return _parameters;
 }
 
+inline uint64 FunctionBase::FunctionBaseImpl::getSignatureFingerprint() const noexcept
+{
+	return _signatureFingerprint;
+}
+
 inline void FunctionBase::FunctionBaseImpl::setParametersCapacity(std::size_t capacity) noexcept
 {
 	_parameters.reserve(capacity);
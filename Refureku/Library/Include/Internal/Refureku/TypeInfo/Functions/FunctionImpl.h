@@ -19,7 +19,7 @@ namespace rfk
 			EFunctionFlags	_flags	= EFunctionFlags::Default;
 
 		public:
-			inline FunctionImpl(char const*		name, 
+			inline FunctionImpl(EntityName		name, 
 								std::size_t		id,
 								Type const&	returnType,
 								ICallable*		internalFunction,
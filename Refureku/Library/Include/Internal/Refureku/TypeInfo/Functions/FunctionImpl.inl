@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Function::FunctionImpl::FunctionImpl(char const* name, std::size_t id,
+inline Function::FunctionImpl::FunctionImpl(EntityName name, std::size_t id,
 											   Type const& returnType, ICallable* internalFunction, EFunctionFlags flags) noexcept:
 	FunctionBaseImpl(name, id, EEntityKind::Function, returnType, internalFunction, nullptr),
 	_flags{flags}
@@ -21,7 +21,7 @@ namespace rfk
 			Type const&	_type;
 
 		public:
-			FunctionParameterImpl(char const*		name,
+			FunctionParameterImpl(EntityName		name,
 								  std::size_t		id,
 								  Type const&	type,
 								  Entity const*	outerEntity)	noexcept;
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-FunctionParameter::FunctionParameterImpl::FunctionParameterImpl(char const* name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
+FunctionParameter::FunctionParameterImpl::FunctionParameterImpl(EntityName name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, EEntityKind::Undefined /* TODO: Add new entity kind for parameters */, outerEntity),
 	_type{type}
 {
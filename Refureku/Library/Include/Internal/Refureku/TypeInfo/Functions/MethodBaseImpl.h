@@ -19,7 +19,7 @@ namespace rfk
 			EMethodFlags	_flags	= EMethodFlags::Default;
 
 		public:
-			inline MethodBaseImpl(char const*	name, 
+			inline MethodBaseImpl(EntityName	name, 
 								  std::size_t	id,
 								  Type const&	returnType,
 								  ICallable*	internalMethod,
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline MethodBase::MethodBaseImpl::MethodBaseImpl(char const* name, std::size_t id, Type const& returnType,
+inline MethodBase::MethodBaseImpl::MethodBaseImpl(EntityName name, std::size_t id, Type const& returnType,
 													 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
 	FunctionBaseImpl(name, id, EEntityKind::Method, returnType, internalMethod, outerEntity),
 	_flags{flags}
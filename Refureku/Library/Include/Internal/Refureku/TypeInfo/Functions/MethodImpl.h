@@ -15,7 +15,7 @@ namespace rfk
 	class Method::MethodImpl final : public MethodBase::MethodBaseImpl
 	{
 		public:
-			inline MethodImpl(char const*		name,
+			inline MethodImpl(EntityName		name,
 							  std::size_t		id,
 							  Type const&	returnType,
 							  ICallable*		internalMethod,
@@ -15,7 +15,7 @@ namespace rfk
 	class StaticMethod::StaticMethodImpl final : public MethodBase::MethodBaseImpl
 	{
 		public:
-			inline StaticMethodImpl(char const*		name,
+			inline StaticMethodImpl(EntityName		name,
 									std::size_t		id,
 									Type const&		returnType,
 									ICallable*			internalMethod,
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline StaticMethod::StaticMethodImpl::StaticMethodImpl(char const* name, std::size_t id, Type const& returnType,
+inline StaticMethod::StaticMethodImpl::StaticMethodImpl(EntityName name, std::size_t id, Type const& returnType,
 													ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
 	MethodBaseImpl(name, id, returnType, internalMethod, flags, outerEntity)
 {
@@ -22,31 +22,31 @@ namespace rfk
 			/** Collection of all entities contained in this namespace fragment. */
 			std::vector<Entity const*>	_nestedEntities;
 
-			/** Pointer to the namespace this fragment merged to. */
-			SharedPtr<Namespace>		_mergedNamespace;
+			/**
+			*	Pointer to the namespace this fragment merged to.
+			*	Only set when the fragment is merged, since merging requires the database write lock.
+			*/
+			mutable SharedPtr<Namespace>	_mergedNamespace;
 
 		public:
-			inline NamespaceFragmentImpl(char const*			name,
-										 std::size_t			id,
-										 SharedPtr<Namespace>&&	mergedNamespace)	noexcept;
+			inline NamespaceFragmentImpl(EntityName		name,
+										 std::size_t	id)	noexcept;
 
 			/**
-			*	@brief Add a nested entity to the fragment as well as the merged namespace.
+			*	@brief	Add a nested entity to the fragment.
+			*			The nested entity is added to the merged namespace when the fragment is merged.
 			*	
 			*	@param nestedEntity The nested entity to add to the namespace fragment.
 			*/
 			inline void								addNestedEntity(Entity const& nestedEntity)			noexcept;
 
 			/**
-			*	@brief	Add a property to this namespace fragment.
-			*			The property is immediately added to the merged namespace.
-			*	
-			*	@param property The property to add.
+			*	@brief	Add this fragment nested entities and properties to the merged namespace.
+			*			Nested namespace fragments must have been merged before this call.
 			*	
-			*	@return	true if the property was added,
-			*			false if it failed to be added (allow multiple is false and the property is already in the entity for example).
+			*	@param mergedNamespace The namespace to merge this fragment to.
 			*/
-			inline bool								addProperty(Property const& property)				noexcept;
+			inline void								mergeFragment(SharedPtr<Namespace>&& mergedNamespace)	const	noexcept;
 
 			/**
 			*	@brief	Set the number of nested entities for this entity.
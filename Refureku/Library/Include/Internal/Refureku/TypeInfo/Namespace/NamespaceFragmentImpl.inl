@@ -5,64 +5,70 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline NamespaceFragment::NamespaceFragmentImpl::NamespaceFragmentImpl(char const* name, std::size_t id, SharedPtr<Namespace>&& mergedNamespace) noexcept:
+inline NamespaceFragment::NamespaceFragmentImpl::NamespaceFragmentImpl(EntityName name, std::size_t id) noexcept:
 	EntityImpl(name, id, EEntityKind::NamespaceFragment),
 	_nestedEntities(),
-	_mergedNamespace(std::forward<SharedPtr<Namespace>>(mergedNamespace))
+	_mergedNamespace()
 {
 }
 
 inline void NamespaceFragment::NamespaceFragmentImpl::addNestedEntity(Entity const& nestedEntity) noexcept
 {
 	_nestedEntities.push_back(&nestedEntity);
+}
+
+inline void NamespaceFragment::NamespaceFragmentImpl::mergeFragment(SharedPtr<Namespace>&& mergedNamespace) const noexcept
+{
+	_mergedNamespace = std::forward<SharedPtr<Namespace>>(mergedNamespace);
 
-	switch (nestedEntity.getKind())
+	for (Property const* property : getProperties())
 	{
-		case EEntityKind::NamespaceFragment:
-			//The same namespace might be added multiple times by different namespace fragments
-			//refering to the same namespace but it is not a problem since the underlying container only keeps the first one
-			_mergedNamespace->addNamespace(static_cast<NamespaceFragment const&>(nestedEntity).getMergedNamespace());
-			break;
-
-		case EEntityKind::Struct:
-			[[fallthrough]];
-		case EEntityKind::Class:
-			[[fallthrough]];
-		case EEntityKind::Enum:
-			_mergedNamespace->addArchetype(static_cast<Archetype const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Variable:
-			_mergedNamespace->addVariable(static_cast<Variable const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Function:
-			_mergedNamespace->addFunction(static_cast<Function const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Namespace:
-			//Nested namespaces should always be added though their NamespaceFragment
-			[[fallthrough]];
-		case EEntityKind::EnumValue:
-			//None of these kind of entities should ever be a namespace nested entity
-			[[fallthrough]];
-		case EEntityKind::Field:
-			[[fallthrough]];
-		case EEntityKind::Method:
-			[[fallthrough]];
-		case EEntityKind::Undefined:
-			[[fallthrough]];
-		default:
-			assert(false);	
-			break;
+		_mergedNamespace->addProperty(*property);
 	}
-}
 
-inline bool	NamespaceFragment::NamespaceFragmentImpl::addProperty(Property const& property) noexcept
-{
-	_mergedNamespace->addProperty(property);
+	for (rfk::Entity const* entity : _nestedEntities)
+	{
+		switch (entity->getKind())
+		{
+			case EEntityKind::NamespaceFragment:
+				//The same namespace might be added multiple times by different namespace fragments
+				//refering to the same namespace but it is not a problem since the underlying container only keeps the first one
+				_mergedNamespace->addNamespace(static_cast<NamespaceFragment const*>(entity)->getMergedNamespace());
+				break;
+
+			case EEntityKind::Struct:
+				[[fallthrough]];
+			case EEntityKind::Class:
+				[[fallthrough]];
+			case EEntityKind::Enum:
+				_mergedNamespace->addArchetype(*static_cast<Archetype const*>(entity));
+				break;
+
+			case EEntityKind::Variable:
+				_mergedNamespace->addVariable(*static_cast<Variable const*>(entity));
+				break;
+
+			case EEntityKind::Function:
+				_mergedNamespace->addFunction(*static_cast<Function const*>(entity));
+				break;
 
-	return EntityImpl::addProperty(property);
+			case EEntityKind::Namespace:
+				//Nested namespaces should always be added though their NamespaceFragment
+				[[fallthrough]];
+			case EEntityKind::EnumValue:
+				//None of these kind of entities should ever be a namespace nested entity
+				[[fallthrough]];
+			case EEntityKind::Field:
+				[[fallthrough]];
+			case EEntityKind::Method:
+				[[fallthrough]];
+			case EEntityKind::Undefined:
+				[[fallthrough]];
+			default:
+				assert(false);
+				break;
+		}
+	}
 }
 
 inline void NamespaceFragment::NamespaceFragmentImpl::unmergeFragment() const noexcept
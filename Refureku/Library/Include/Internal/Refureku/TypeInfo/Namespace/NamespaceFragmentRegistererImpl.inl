@@ -11,6 +11,11 @@ inline internal::NamespaceFragmentRegistererImpl::NamespaceFragmentRegistererImp
 	//Only register file level namespaces
 	assert(namespaceFragment.getOuterEntity() == nullptr);
 
+	Database::DatabaseImpl::WriteLockGuard lock(*Database::getInstance()._pimpl);
+
+	//Merge the fragment from here rather than while it is filled, since the merged namespaces are protected by the database lock
+	_registeredFragment.mergeFragment();
+
 	Database::getInstance()._pimpl->registerFileLevelEntityRecursive(_registeredFragment);
 }
 
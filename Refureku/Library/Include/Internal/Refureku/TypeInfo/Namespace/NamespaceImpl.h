@@ -7,24 +7,22 @@
 
 #pragma once
 
-#include <unordered_set>
-
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 #include "Refureku/TypeInfo/Entity/EntityImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 #include "Refureku/TypeInfo/Variables/Variable.h"
 #include "Refureku/TypeInfo/Functions/Function.h"
-#include "Refureku/TypeInfo/Entity/EntityHash.h"
+#include "Refureku/TypeInfo/Entity/EntityNameIndex.h"
 
 namespace rfk
 {
 	class Namespace::NamespaceImpl final : public Entity::EntityImpl
 	{
 		public:
-			using NamespaceHashSet	= std::unordered_set<Namespace const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using ArchetypeHashSet	= std::unordered_set<Archetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using VariableHashSet	= std::unordered_set<Variable const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using FunctionHashSet	= std::unordered_multiset<Function const*, EntityPtrNameHash, EntityPtrNameEqual>;
+			using NamespaceHashSet	= EntityNameIndex<Namespace>;
+			using ArchetypeHashSet	= EntityNameIndex<Archetype>;
+			using VariableHashSet	= EntityNameIndex<Variable>;
+			using FunctionHashSet	= EntityNameIndex<Function, true>;
 
 		private:
 			/** Collection of all namespaces contained in this namespace. */
@@ -40,7 +38,7 @@ namespace rfk
 			FunctionHashSet		_functions;
 			
 		public:
-			inline NamespaceImpl(char const* name,
+			inline NamespaceImpl(EntityName name,
 								 std::size_t id)		noexcept;
 
 			/**
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Namespace::NamespaceImpl::NamespaceImpl(char const* name, std::size_t id) noexcept:
+inline Namespace::NamespaceImpl::NamespaceImpl(EntityName name, std::size_t id) noexcept:
 	EntityImpl(name, id, EEntityKind::Namespace)
 {
 }
@@ -22,7 +22,7 @@ namespace rfk
 			Struct const*	_owner	= nullptr;
 
 		public:
-			inline FieldBaseImpl(char const*		name,
+			inline FieldBaseImpl(EntityName		name,
 								 std::size_t		id,
 								 Type const&		type,
 								 EFieldFlags		flags,
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline FieldBase::FieldBaseImpl::FieldBaseImpl(char const* name, std::size_t id, Type const& type, EFieldFlags flags, Struct const* owner, Entity const* outerEntity) noexcept:
+inline FieldBase::FieldBaseImpl::FieldBaseImpl(EntityName name, std::size_t id, Type const& type, EFieldFlags flags, Struct const* owner, Entity const* outerEntity) noexcept:
 	VariableBaseImpl(name, id, EEntityKind::Field, type, outerEntity),
 	_flags{flags},
 	_owner{owner}
@@ -19,7 +19,7 @@ namespace rfk
 			std::size_t	_memoryOffset	= 0u;
 
 		public:
-			inline FieldImpl(char const*		name,
+			inline FieldImpl(EntityName		name,
 							 std::size_t		id,
 							 Type const&		type,
 							 EFieldFlags		flags,
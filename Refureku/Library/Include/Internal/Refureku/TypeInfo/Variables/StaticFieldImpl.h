@@ -23,14 +23,14 @@ namespace rfk
 			};
 
 		public:
-			inline StaticFieldImpl(char const*		name,
+			inline StaticFieldImpl(EntityName		name,
 								   std::size_t		id,
 								   Type const&	type,
 								   EFieldFlags		flags,
 								   Struct const*	owner,
 								   void*			ptr,
 								   Entity const*	outerEntity)	noexcept;
-			inline StaticFieldImpl(char const*		name,
+			inline StaticFieldImpl(EntityName		name,
 								   std::size_t		id,
 								   Type const&	type,
 								   EFieldFlags		flags,
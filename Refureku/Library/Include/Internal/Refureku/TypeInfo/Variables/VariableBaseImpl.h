@@ -19,7 +19,7 @@ namespace rfk
 			Type const&	_type;
 
 		public:
-			inline VariableBaseImpl(char const*			name,
+			inline VariableBaseImpl(EntityName			name,
 									std::size_t			id,
 									EEntityKind			kind,
 									Type const&		type,
@@ -5,7 +5,7 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline VariableBase::VariableBaseImpl::VariableBaseImpl(char const* name, std::size_t id, EEntityKind kind, Type const& type, Entity const* outerEntity) noexcept:
+inline VariableBase::VariableBaseImpl::VariableBaseImpl(EntityName name, std::size_t id, EEntityKind kind, Type const& type, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, kind, outerEntity),
 	_type{type}
 {
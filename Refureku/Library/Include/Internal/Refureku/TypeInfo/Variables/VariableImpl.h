@@ -26,12 +26,12 @@ namespace rfk
 			};
 
 		public:
-			inline VariableImpl(char const*		name,
+			inline VariableImpl(EntityName		name,
 								std::size_t		id,
 								Type const&	type,
 								void*			ptr,
 								EVarFlags		flags)		noexcept;
-			inline VariableImpl(char const*		name,
+			inline VariableImpl(EntityName		name,
 								std::size_t		id,
 								Type const&	type,
 								void const*		constPtr,
@@ -5,14 +5,14 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline Variable::VariableImpl::VariableImpl(char const* name, std::size_t id, Type const& type, void* ptr, EVarFlags flags) noexcept:
+inline Variable::VariableImpl::VariableImpl(EntityName name, std::size_t id, Type const& type, void* ptr, EVarFlags flags) noexcept:
 	VariableBaseImpl(name, id, EEntityKind::Variable, type, nullptr),
 	_flags{flags},
 	_ptr{ptr}
 {
 }
 
-inline Variable::VariableImpl::VariableImpl(char const* name, std::size_t id, Type const& type, void const* constPtr, EVarFlags flags) noexcept:
+inline Variable::VariableImpl::VariableImpl(EntityName name, std::size_t id, Type const& type, void const* constPtr, EVarFlags flags) noexcept:
 	VariableBaseImpl(name, id, EEntityKind::Variable, type, nullptr),
 	_flags{flags},
 	_constPtr{constPtr}
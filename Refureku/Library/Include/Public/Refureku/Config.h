@@ -27,6 +27,15 @@
 	#define RFK_NON_PUBLIC_NESTED_CLASS_TEMPLATE_SUPPORT 0
 #endif
 
+/**
+*	RFK_COPY_LITERAL_ENTITY_NAMES: Copy the names built with rfk::EntityName::fromLiteral instead of referencing them.
+*	Define it to 1 when compiling a module (dynamic library) which can be unloaded while its entities are still reachable,
+*	since its string literals are unmapped with it.
+*/
+#ifndef RFK_COPY_LITERAL_ENTITY_NAMES
+	#define RFK_COPY_LITERAL_ENTITY_NAMES 0
+#endif
+
 //Debug / Release flags
 #ifndef NDEBUG
 
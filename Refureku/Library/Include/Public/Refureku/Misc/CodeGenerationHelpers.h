@@ -9,9 +9,12 @@
 
 #include <array>
 #include <cstddef>	//std::size_t, std::ptrdiff_t
+#include <string_view>
+#include <type_traits>
 
 #include "Refureku/Config.h"
 #include "Refureku/Misc/TypeTraitsMacros.h"
+#include "Refureku/Misc/EntityIdHash.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/Misc/SharedPtr.h"
@@ -34,6 +37,44 @@ namespace rfk::internal
 
 	class CodeGenerationHelpers
 	{
+		private:
+			/**
+			*	@brief	Check whether the class T provides its own canonical name through the generated _rfk_hashCanonicalName method.
+			*			The method of a reflected parent class is not considered as the canonical name of T.
+			* 
+			*	@tparam T Target class.
+			* 
+			*	@return true if T has its own canonical name, else false.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr auto	hasCanonicalName(int)							noexcept -> decltype(T::_rfk_hashCanonicalName(0u, static_cast<T const*>(nullptr)), bool());
+
+			template <typename T>
+			RFK_NODISCARD static constexpr bool	hasCanonicalName(...)							noexcept;
+
+			/**
+			*	@brief Retrieve the name of a fundamental type.
+			* 
+			*	@tparam T Target type.
+			* 
+			*	@return The name of T if it is a fundamental type, else an empty string.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr std::string_view	getFundamentalTypename()			noexcept;
+
+			/**
+			*	@brief Hash the decimal representation of an integer.
+			* 
+			*	@param seed			Hash of the characters preceding the integer.
+			*	@param isNegative	Should a minus sign precede the integer?
+			*	@param magnitude	Absolute value of the integer.
+			* 
+			*	@return The hash of the integer.
+			*/
+			RFK_NODISCARD static constexpr uint64	hashInteger(uint64	seed,
+															bool	isNegative,
+															uint64	magnitude)					noexcept;
+
 		public:
 			CodeGenerationHelpers()		= delete;
 			~CodeGenerationHelpers()	= delete;
@@ -76,6 +117,34 @@ namespace rfk::internal
 			template <typename ClassType>
 			RFK_NODISCARD static std::size_t				getReflectedStaticFieldsCount()				noexcept;
 
+			/**
+			*	@brief	Hash the canonical name of the type T, which is the same on every compiler.
+			*			Reflected classes and class template instantiations provide their qualified name through the generated
+			*			_rfk_hashCanonicalName method, fundamental types use their keyword and compound types decorate the name of their element type.
+			*			Other types (enums, non reflected classes, function types...) fall back on the compiler generated type name.
+			* 
+			*	@tparam T Target type.
+			* 
+			*	@param seed Hash of the characters preceding the type name.
+			* 
+			*	@return The hash of the canonical name of T chained after seed.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr uint64			hashCanonicalTypename(uint64 seed)			noexcept;
+
+			/**
+			*	@brief	Hash the canonical representation of a non-type template argument.
+			*			Integral and enum values are hashed as decimal integers, other values fall back on the compiler generated name.
+			* 
+			*	@tparam Value Target value.
+			* 
+			*	@param seed Hash of the characters preceding the value.
+			* 
+			*	@return The hash of the canonical representation of Value chained after seed.
+			*/
+			template <auto Value>
+			RFK_NODISCARD static constexpr uint64			hashCanonicalValue(uint64 seed)				noexcept;
+
 			/**
 			*	@brief	Instantiate a class if it is default constructible.
 			*			This is the default method used to instantiate classes through Struct::makeSharedInstance.
@@ -116,6 +185,12 @@ namespace rfk::internal
 	{
 	};
 
+	/** Type wrapping a non-type template argument to name it through getTypename. */
+	template <auto>
+	struct TemplateValueTag
+	{
+	};
+
 	struct RawTypenameFormat
 	{
 		/** Number of chars before getting the type part in the __PRETTY_FUNCTION__ / __FUNCSIG__ string. */
@@ -224,5 +299,35 @@ __RFK_DISABLE_WARNING_POP
 		return name.data();
 	}
 
+	/**
+	*	@brief Hash the typename of the type T with rfk::computeEntityIdHash.
+	* 
+	*	@tparam T Target type.
+	* 
+	*	@param seed Seed of the hash.
+	* 
+	*	@return The hash of the typename of T.
+	*/
+	template <typename T>
+	constexpr uint64 computeTypenameEntityIdHash(uint64 seed) noexcept
+	{
+		constexpr auto name = getTypenameAsArray<T>();
+
+		//Exclude the null terminator
+		return computeEntityIdHash(std::string_view(name.data(), name.size() - 1u), seed);
+	}
+
+	/**
+	*	Id of an entity generated for each type T, like the members of a class template instantiation
+	*	or the fields a class inherits from its reflected parents.
+	*	It is the hash of the entity id followed by the canonical name of T, so that it doesn't depend on the compiler.
+	*	It is a variable template so that the id is always computed at compile time.
+	* 
+	*	@tparam T				Type the entity is generated for.
+	*	@tparam EntityIdHash	Hash of the entity id computed by the generator.
+	*/
+	template <typename T, uint64 EntityIdHash>
+	inline constexpr uint64 typeNestedEntityId = CodeGenerationHelpers::hashCanonicalTypename<T>(EntityIdHash);
+
 	#include "Refureku/Misc/CodeGenerationHelpers.inl"
 }
\ No newline at end of file
@@ -80,4 +80,142 @@ noexcept(!std::is_default_constructible_v<T> || std::is_nothrow_constructible_v<
 	{
 		return nullptr;
 	}
+}
+
+template <typename T>
+constexpr auto CodeGenerationHelpers::hasCanonicalName(int) noexcept -> decltype(T::_rfk_hashCanonicalName(0u, static_cast<T const*>(nullptr)), bool())
+{
+	//A class inheriting from a reflected class can call its parent method, but the parameter type tells the owner apart
+	return std::is_same_v<decltype(T::_rfk_hashCanonicalName), uint64(uint64, T const*) noexcept>;
+}
+
+template <typename T>
+constexpr bool CodeGenerationHelpers::hasCanonicalName(...) noexcept
+{
+	return false;
+}
+
+template <typename T>
+constexpr std::string_view CodeGenerationHelpers::getFundamentalTypename() noexcept
+{
+	if constexpr (std::is_same_v<T, void>)					return "void";
+	else if constexpr (std::is_same_v<T, std::nullptr_t>)		return "std::nullptr_t";
+	else if constexpr (std::is_same_v<T, bool>)					return "bool";
+	else if constexpr (std::is_same_v<T, char>)					return "char";
+	else if constexpr (std::is_same_v<T, signed char>)			return "signed char";
+	else if constexpr (std::is_same_v<T, unsigned char>)		return "unsigned char";
+	else if constexpr (std::is_same_v<T, wchar_t>)				return "wchar_t";
+	else if constexpr (std::is_same_v<T, char16_t>)				return "char16_t";
+	else if constexpr (std::is_same_v<T, char32_t>)				return "char32_t";
+	else if constexpr (std::is_same_v<T, short>)				return "short";
+	else if constexpr (std::is_same_v<T, unsigned short>)		return "unsigned short";
+	else if constexpr (std::is_same_v<T, int>)					return "int";
+	else if constexpr (std::is_same_v<T, unsigned int>)			return "unsigned int";
+	else if constexpr (std::is_same_v<T, long>)					return "long";
+	else if constexpr (std::is_same_v<T, unsigned long>)		return "unsigned long";
+	else if constexpr (std::is_same_v<T, long long>)			return "long long";
+	else if constexpr (std::is_same_v<T, unsigned long long>)	return "unsigned long long";
+	else if constexpr (std::is_same_v<T, float>)				return "float";
+	else if constexpr (std::is_same_v<T, double>)				return "double";
+	else if constexpr (std::is_same_v<T, long double>)			return "long double";
+	else														return "";
+}
+
+constexpr uint64 CodeGenerationHelpers::hashInteger(uint64 seed, bool isNegative, uint64 magnitude) noexcept
+{
+	char		digits[20]	= {};
+	std::size_t	digitsCount	= 0u;
+
+	do
+	{
+		digits[digitsCount++] = static_cast<char>('0' + magnitude % 10u);
+		magnitude /= 10u;
+	} while (magnitude != 0u);
+
+	if (isNegative)
+	{
+		seed = combineHashByte(seed, static_cast<unsigned char>('-'));
+	}
+
+	//Digits were extracted from the least significant one
+	while (digitsCount > 0u)
+	{
+		seed = combineHashByte(seed, static_cast<unsigned char>(digits[--digitsCount]));
+	}
+
+	return seed;
+}
+
+template <typename T>
+constexpr uint64 CodeGenerationHelpers::hashCanonicalTypename(uint64 seed) noexcept
+{
+	if constexpr (std::is_const_v<T> || std::is_volatile_v<T>)
+	{
+		seed = hashCanonicalTypename<std::remove_cv_t<T>>(seed);
+		seed = std::is_const_v<T> ? computeEntityIdHash(" const", seed) : seed;
+
+		return std::is_volatile_v<T> ? computeEntityIdHash(" volatile", seed) : seed;
+	}
+	else if constexpr (std::is_pointer_v<T>)
+	{
+		return computeEntityIdHash("*", hashCanonicalTypename<std::remove_pointer_t<T>>(seed));
+	}
+	else if constexpr (std::is_lvalue_reference_v<T>)
+	{
+		return computeEntityIdHash("&", hashCanonicalTypename<std::remove_reference_t<T>>(seed));
+	}
+	else if constexpr (std::is_rvalue_reference_v<T>)
+	{
+		return computeEntityIdHash("&&", hashCanonicalTypename<std::remove_reference_t<T>>(seed));
+	}
+	else if constexpr (std::is_array_v<T>)
+	{
+		seed = computeEntityIdHash("[", hashCanonicalTypename<std::remove_extent_t<T>>(seed));
+		seed = (std::extent_v<T> != 0u) ? hashInteger(seed, false, std::extent_v<T>) : seed;
+
+		return computeEntityIdHash("]", seed);
+	}
+	else if constexpr (!getFundamentalTypename<T>().empty())
+	{
+		return computeEntityIdHash(getFundamentalTypename<T>(), seed);
+	}
+	else if constexpr (hasCanonicalName<T>(0))
+	{
+		return T::_rfk_hashCanonicalName(seed, nullptr);
+	}
+	else
+	{
+		return computeTypenameEntityIdHash<T>(seed);
+	}
+}
+
+template <auto Value>
+constexpr uint64 CodeGenerationHelpers::hashCanonicalValue(uint64 seed) noexcept
+{
+	using ValueType = decltype(Value);
+
+	if constexpr (std::is_same_v<ValueType, bool>)
+	{
+		return computeEntityIdHash(Value ? "true" : "false", seed);
+	}
+	else if constexpr (std::is_integral_v<ValueType> || std::is_enum_v<ValueType>)
+	{
+		using IntegerType = typename std::conditional_t<std::is_enum_v<ValueType>, std::underlying_type<ValueType>, std::common_type<ValueType>>::type;
+
+		constexpr IntegerType value = static_cast<IntegerType>(Value);
+
+		if constexpr (std::is_signed_v<IntegerType>)
+		{
+			//Negate in unsigned arithmetic so that the smallest signed value doesn't overflow
+			return (value < 0) ? hashInteger(seed, true, uint64(0u) - static_cast<uint64>(value)) : hashInteger(seed, false, static_cast<uint64>(value));
+		}
+		else
+		{
+			return hashInteger(seed, false, static_cast<uint64>(value));
+		}
+	}
+	else
+	{
+		return computeTypenameEntityIdHash<TemplateValueTag<Value>>(seed);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string_view>
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/** FNV-1a 64 bits offset basis, which is the hash of an empty byte sequence. */
+	constexpr uint64 fnv1aOffsetBasis = 14695981039346656037ull;
+
+	/** FNV-1a 64 bits prime. */
+	constexpr uint64 fnv1aPrime = 1099511628211ull;
+
+	/** Seed of computeEntityIdHash. */
+	constexpr uint64 entityIdHashSeed = fnv1aOffsetBasis;
+
+	/**
+	*	@brief Add a byte to a FNV-1a 64 bits hash.
+	* 
+	*	@param hash Hash of the bytes so far.
+	*	@param byte Byte to add to the hash.
+	* 
+	*	@return The updated hash.
+	*/
+	constexpr uint64 combineHashByte(uint64			hash,
+									 unsigned char	byte)	noexcept;
+
+	/**
+	*	@brief	Add the bytes of a value to a FNV-1a 64 bits hash, from the least significant to the most significant one.
+	*			The result doesn't depend on the platform endianness.
+	* 
+	*	@param hash		Hash of the bytes so far.
+	*	@param value	Value to add to the hash.
+	* 
+	*	@return The updated hash.
+	*/
+	constexpr uint64 combineHash(uint64 hash,
+								 uint64 value)	noexcept;
+
+	/**
+	*	@brief	Add raw memory to a FNV-1a 64 bits hash.
+	*			The memory must be fully initialized (no padding bytes).
+	* 
+	*	@param hash Hash of the bytes so far.
+	*	@param data Pointer to the first byte to add.
+	*	@param size Number of bytes to add.
+	* 
+	*	@return The updated hash.
+	*/
+	inline uint64	combineHashBytes(uint64			hash,
+									 void const*	data,
+									 std::size_t	size)	noexcept;
+
+	/**
+	*	@brief	Compute the FNV-1a 64 bits hash of a string.
+	*			Unlike std::hash, the result is the same on every platform and with every standard library implementation,
+	*			so it is used to compute entity ids both by the generator and at runtime.
+	*			This header must only depend on the standard library since it is also included by the generator.
+	* 
+	*	@param str	String to hash.
+	*	@param seed	Initial hash value. Passing the hash of a string s1 computes the hash of s1 concatenated with str.
+	* 
+	*	@return The hash of str.
+	*/
+	constexpr uint64 computeEntityIdHash(std::string_view	str,
+										 uint64				seed = entityIdHashSeed)	noexcept;
+
+	#include "Refureku/Misc/EntityIdHash.inl"
+}
\ No newline at end of file
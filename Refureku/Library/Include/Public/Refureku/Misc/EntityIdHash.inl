@@ -0,0 +1,43 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr uint64 combineHashByte(uint64 hash, unsigned char byte) noexcept
+{
+	return (hash ^ static_cast<uint64>(byte)) * fnv1aPrime;
+}
+
+constexpr uint64 combineHash(uint64 hash, uint64 value) noexcept
+{
+	for (std::size_t i = 0u; i < sizeof(value); i++)
+	{
+		hash = combineHashByte(hash, static_cast<unsigned char>(value >> (i * 8u)));
+	}
+
+	return hash;
+}
+
+inline uint64 combineHashBytes(uint64 hash, void const* data, std::size_t size) noexcept
+{
+	for (std::size_t i = 0u; i < size; i++)
+	{
+		hash = combineHashByte(hash, static_cast<unsigned char const*>(data)[i]);
+	}
+
+	return hash;
+}
+
+constexpr uint64 computeEntityIdHash(std::string_view str, uint64 seed) noexcept
+{
+	uint64 hash = seed;
+
+	for (char c : str)
+	{
+		hash = combineHashByte(hash, static_cast<unsigned char>(c));
+	}
+
+	return hash;
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <atomic>
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk::internal
+{
+	/**
+	*	Guard used to lazily initialize reflection metadata stored in function local statics (getType, getArchetype, ...).
+	*	Once the initialization is complete, checking the guard costs a single acquire load.
+	*	Initializations are serialized through a single library-wide recursive mutex so that:
+	*		- a thread never observes partially filled metadata initialized by another thread,
+	*		- metadata depending on each other (cyclic references between types) can't deadlock,
+	*		- a thread recursively requesting the metadata it is currently initializing gets the partially filled metadata
+	*			(same behaviour as the previous plain "static bool initialized" guard).
+	*	A single mutex is used rather than a per-entity once flag because metadata initializations may depend on each other
+	*	in any order, which could deadlock two threads initializing different entities.
+	*
+	*	Lock order: a thread owning the database lock may initialize metadata (registration batches, database visitors calling getType, ...),
+	*	but the database lock must never be acquired while initializing metadata. Initializations therefore only fill the metadata itself,
+	*	and everything touching the database (namespace merging, indexing) is done by the registerers.
+	*	This order is asserted when the database lock is acquired.
+	*
+	*	Usage:
+	*		static rfk::internal::InitializationGuard initGuard;
+	*		if (initGuard.tryBeginInitialization()) { ...fill metadata...; initGuard.endInitialization(); }
+	*/
+	class InitializationGuard final
+	{
+		private:
+			enum class EState : uint8
+			{
+				Uninitialized = 0u,
+				Initializing,
+				Initialized
+			};
+
+			/** Current initialization state of the guarded metadata. */
+			std::atomic<EState>	_state;
+
+			/**
+			*	@brief	Slow path of tryBeginInitialization, called as long as the initialization is not complete.
+			*			If this call returns true, the library initialization mutex is kept locked until endInitialization is called.
+			* 
+			*	@return true if the caller must initialize the guarded metadata, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool	tryBeginInitializationSlow()		noexcept;
+
+		public:
+			constexpr InitializationGuard()								noexcept;
+			InitializationGuard(InitializationGuard const&)				= delete;
+			InitializationGuard(InitializationGuard&&)					= delete;
+			~InitializationGuard()										= default;
+
+			/**
+			*	@brief	Check whether the guarded metadata must be initialized by the caller.
+			*			If another thread is currently initializing the metadata, wait until it is done.
+			*			If true is returned, endInitialization must be called once the initialization is complete.
+			* 
+			*	@return true if the caller must initialize the guarded metadata, else false.
+			*/
+			RFK_NODISCARD inline bool		tryBeginInitialization()			noexcept;
+
+			/**
+			*	@brief	Mark the guarded metadata as initialized and publish it to other threads.
+			*			Must be called exactly once after tryBeginInitialization returned true.
+			*/
+			REFUREKU_API void				endInitialization()					noexcept;
+
+			/**
+			*	@brief Check whether the calling thread is currently initializing metadata (between tryBeginInitialization and endInitialization).
+			*
+			*	@return true if the calling thread is initializing metadata, else false.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL static bool	isInitializingOnCallingThread()	noexcept;
+
+			InitializationGuard& operator=(InitializationGuard const&)	= delete;
+			InitializationGuard& operator=(InitializationGuard&&)		= delete;
+	};
+
+	#include "Refureku/Misc/InitializationGuard.inl"
+}
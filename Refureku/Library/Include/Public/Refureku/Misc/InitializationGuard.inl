@@ -0,0 +1,16 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr InitializationGuard::InitializationGuard() noexcept:
+	_state{EState::Uninitialized}
+{
+}
+
+inline bool InitializationGuard::tryBeginInitialization() noexcept
+{
+	return _state.load(std::memory_order_acquire) != EState::Initialized && tryBeginInitializationSlow();
+}
@@ -0,0 +1,147 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t, std::max_align_t
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	namespace internal
+	{
+		//Forward declaration
+		class MetadataArenaImpl;
+	}
+
+	/**
+	*	Opt-in arena allocator for the reflection metadata of a module.
+	*	While a MetadataArenaScope is alive on a thread, the metadata allocated by that thread
+	*	(entities implementations, struct members storage, function parameters, ICallable instances)
+	*	is bump-allocated from the arena instead of the global heap.
+	*	The typical usage is to load a module (dynamic library) inside a scope, so that all the metadata registered
+	*	during the module static initialization comes from a few big blocks:
+	*
+	*		rfk::MetadataArena moduleArena;
+	*		{
+	*			rfk::MetadataArenaScope scope(moduleArena);
+	*			loadModule(...);
+	*		}
+	*		...
+	*		unloadModule(...);	//Registerers unregister and metadata is destroyed
+	*
+	*	The arena memory is released in bulk once the arena is destroyed and all the metadata allocated from it has been destroyed,
+	*	so destroying the arena before unloading the module is safe.
+	*/
+	class MetadataArena final
+	{
+		private:
+			/** Actual arena, which can outlive this object as long as some metadata allocated from it is alive. */
+			internal::MetadataArenaImpl*	_impl;
+
+		public:
+			/**
+			*	@param blockSize Size in bytes of the memory blocks allocated by the arena.
+			*/
+			REFUREKU_API explicit MetadataArena(std::size_t blockSize = 64u * 1024u)	noexcept;
+			MetadataArena(MetadataArena const&)											= delete;
+			MetadataArena(MetadataArena&&)												= delete;
+			REFUREKU_API ~MetadataArena()												noexcept;
+
+			/**
+			*	@brief Get the number of allocations made from the arena which have not been deallocated yet.
+			* 
+			*	@return The number of alive allocations.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t	getAliveAllocationsCount()	const	noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated by the arena from the global heap.
+			* 
+			*	@return The number of bytes reserved by the arena.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t	getReservedBytes()			const	noexcept;
+
+			MetadataArena& operator=(MetadataArena const&)	= delete;
+			MetadataArena& operator=(MetadataArena&&)		= delete;
+
+		friend class MetadataArenaScope;
+	};
+
+	/**
+	*	RAII object making the calling thread allocate its reflection metadata from the provided arena while it is alive.
+	*	Scopes can be nested, the innermost scope being used.
+	*/
+	class MetadataArenaScope final
+	{
+		private:
+			/** Arena used by the thread before this scope was created. */
+			internal::MetadataArenaImpl*	_previousArena;
+
+		public:
+			REFUREKU_API explicit MetadataArenaScope(MetadataArena& arena)	noexcept;
+			MetadataArenaScope(MetadataArenaScope const&)					= delete;
+			MetadataArenaScope(MetadataArenaScope&&)						= delete;
+			REFUREKU_API ~MetadataArenaScope()								noexcept;
+
+			MetadataArenaScope& operator=(MetadataArenaScope const&)	= delete;
+			MetadataArenaScope& operator=(MetadataArenaScope&&)			= delete;
+	};
+
+	namespace internal
+	{
+		/**
+		*	@brief	Allocate memory for reflection metadata.
+		*			The memory comes from the arena of the innermost MetadataArenaScope of the calling thread if any,
+		*			else it is a plain ::operator new allocation without any overhead.
+		*			The returned memory is aligned on alignof(std::max_align_t).
+		* 
+		*	@param size Number of bytes to allocate.
+		* 
+		*	@return The allocated memory.
+		* 
+		*	@exception std::bad_alloc if the allocation failed.
+		*/
+		RFK_NODISCARD REFUREKU_API void*	allocateMetadata(std::size_t size);
+
+		/**
+		*	@brief	Deallocate memory allocated with allocateMetadata, from any thread.
+		* 
+		*	@param ptr The memory to deallocate. Can be nullptr.
+		*/
+		REFUREKU_API void					deallocateMetadata(void* ptr)	noexcept;
+
+		/**
+		*	Stateless allocator allocating with allocateMetadata, usable with standard containers.
+		*/
+		template <typename T>
+		class MetadataAllocator
+		{
+			static_assert(alignof(T) <= alignof(std::max_align_t), "MetadataAllocator doesn't support over-aligned types.");
+
+			public:
+				using value_type = T;
+
+				MetadataAllocator()										= default;
+
+				template <typename U>
+				MetadataAllocator(MetadataAllocator<U> const&)			noexcept;
+
+				RFK_NODISCARD T*	allocate(std::size_t count);
+				void				deallocate(T* ptr, std::size_t)		noexcept;
+
+				template <typename U>
+				bool				operator==(MetadataAllocator<U> const&)	const	noexcept;
+
+				template <typename U>
+				bool				operator!=(MetadataAllocator<U> const&)	const	noexcept;
+		};
+	}
+
+	#include "Refureku/Misc/MetadataArena.inl"
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+template <typename U>
+internal::MetadataAllocator<T>::MetadataAllocator(MetadataAllocator<U> const&) noexcept
+{
+}
+
+template <typename T>
+T* internal::MetadataAllocator<T>::allocate(std::size_t count)
+{
+	return static_cast<T*>(allocateMetadata(count * sizeof(T)));
+}
+
+template <typename T>
+void internal::MetadataAllocator<T>::deallocate(T* ptr, std::size_t) noexcept
+{
+	deallocateMetadata(ptr);
+}
+
+template <typename T>
+template <typename U>
+bool internal::MetadataAllocator<T>::operator==(MetadataAllocator<U> const&) const noexcept
+{
+	//All allocators are interchangeable since deallocateMetadata finds where the memory comes from
+	return true;
+}
+
+template <typename T>
+template <typename U>
+bool internal::MetadataAllocator<T>::operator!=(MetadataAllocator<U> const&) const noexcept
+{
+	return false;
+}
\ No newline at end of file
@@ -8,6 +8,8 @@
 #pragma once
 
 #include "Refureku/Config.h"
+#include "Refureku/Misc/MetadataArena.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 #include "Refureku/TypeInfo/Type.h"
 #include "Refureku/TypeInfo/Database.h"
@@ -24,6 +26,7 @@
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/EnumValue.h"
+#include "Refureku/TypeInfo/Archetypes/EnumTable.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
@@ -7,17 +7,20 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 
 namespace rfk
 {
-	//Forward declaration
+	//Forward declarations
 	class EnumValue;
+	class Database;
 
 	class Enum final : public Archetype
 	{
 		public:
-			REFUREKU_API Enum(char const*		name,
+			REFUREKU_API Enum(EntityName		name,
 							  std::size_t		id,
 							  Archetype const*	underlyingArchetype,
 							  Entity const*		outerEntity = nullptr)	noexcept;
@@ -32,6 +35,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API
 				EnumValue const*			getEnumValueByName(char const* name)						const	noexcept;
+			RFK_NODISCARD REFUREKU_API
+				EnumValue const*			getEnumValueByName(std::string_view name)					const	noexcept;
 
 			/**
 			*	@brief Search an enum value by value in this enum.
@@ -134,7 +139,7 @@ namespace rfk
 			*			If any of the parameters is unvalid, no enum value is added and nullptr is returned.
 			*/
 			REFUREKU_API 
-				EnumValue*					addEnumValue(char const*	name,
+				EnumValue*					addEnumValue(EntityName	name,
 														 std::size_t	id,
 														 int64			value)									noexcept;
 
@@ -153,6 +158,8 @@ namespace rfk
 			class EnumImpl;
 
 			RFK_GEN_GET_PIMPL(EnumImpl, Entity::getPimpl())
+
+		friend Database;
 	};
 
 	/** Base implementation of getEnum, specialized for each reflected enum. */
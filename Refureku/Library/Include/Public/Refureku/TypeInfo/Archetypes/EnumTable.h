@@ -0,0 +1,143 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>		//std::size_t
+#include <optional>
+#include <string_view>
+#include <type_traits>	//std::underlying_type_t, std::make_unsigned_t, std::conditional_t, std::is_enum_v
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	/**
+	*	Entry of an enum table, associating an enum value name with its value.
+	*/
+	template <typename EnumType>
+	struct EnumTableEntry
+	{
+		/** Name of the enum value. */
+		std::string_view	name;
+
+		/** Value of the enum value. */
+		EnumType			value;
+	};
+
+	/**
+	*	Compile-time table of the enum values of a reflected enum, specialized by the generated code for each reflected enum.
+	*	A specialization provides a static constexpr std::array<EnumTableEntry<EnumType>, N> named entries,
+	*	containing all the enum values in declaration order.
+	*	The table is usable in constant expressions and never touches the Database.
+	*
+	*	@tparam EnumType Reflected enum type.
+	*/
+	template <typename EnumType>
+	struct EnumTable;
+
+	/**
+	*	@brief	Get the name of an enum value without going through the Database.
+	*			The lookup is a direct array access if the enum values are contiguous, else a binary search.
+	*			If multiple enum values share the provided value, the name of the first declared one is returned.
+	* 
+	*	@tparam EnumType Reflected enum type.
+	* 
+	*	@param value The enum value.
+	* 
+	*	@return The name of the enum value if value is a declared enum value, else an empty string view.
+	*/
+	template <typename EnumType>
+	RFK_NODISCARD constexpr std::string_view		enumToString(EnumType value)			noexcept;
+
+	/**
+	*	@brief	Get an enum value from its name without going through the Database.
+	*			The lookup is a binary search in the enum values sorted by name.
+	* 
+	*	@tparam EnumType Reflected enum type.
+	* 
+	*	@param name The name of the enum value.
+	* 
+	*	@return The enum value named name if any, else an empty optional.
+	*/
+	template <typename EnumType>
+	RFK_NODISCARD constexpr std::optional<EnumType>	stringToEnum(std::string_view name)		noexcept;
+
+	namespace internal
+	{
+		/**
+		*	Lookup tables computed at compile time from EnumTable<EnumType>::entries.
+		*/
+		template <typename EnumType>
+		class EnumTableHelper
+		{
+			static_assert(std::is_enum_v<EnumType>, "EnumTable can only be used with enum types.");
+
+			public:
+				using UnderlyingType	= std::underlying_type_t<EnumType>;
+				using Entries			= std::decay_t<decltype(EnumTable<EnumType>::entries)>;
+
+				/** Unsigned counterpart of UnderlyingType, used for wrapping arithmetic. bool has none, so it is handled as an unsigned char. */
+				using UnsignedType		= std::make_unsigned_t<std::conditional_t<std::is_same_v<UnderlyingType, bool>, unsigned char, UnderlyingType>>;
+
+			private:
+				/**
+				*	@brief Stable sort the enum table entries at compile time.
+				* 
+				*	@param isLess Strict weak ordering of the entries.
+				* 
+				*	@return The sorted entries.
+				*/
+				template <typename Compare>
+				RFK_NODISCARD static constexpr Entries	sortEntries(Compare isLess)	noexcept;
+
+				/**
+				*	@brief Check whether the values of entriesByValue are all distinct and form a contiguous range.
+				* 
+				*	@return true if the entry of a value is at index (value - smallest value) in entriesByValue, else false.
+				*/
+				RFK_NODISCARD static constexpr bool		computeHasContiguousValues()	noexcept;
+
+			public:
+				/** Entries sorted by value. Entries sharing a value are kept in declaration order. */
+				static constexpr Entries	entriesByValue		= sortEntries([](EnumTableEntry<EnumType> const& lhs, EnumTableEntry<EnumType> const& rhs)
+																			  {
+																				  return static_cast<UnderlyingType>(lhs.value) < static_cast<UnderlyingType>(rhs.value);
+																			  });
+
+				/** Entries sorted by name. */
+				static constexpr Entries	entriesByName		= sortEntries([](EnumTableEntry<EnumType> const& lhs, EnumTableEntry<EnumType> const& rhs)
+																			  {
+																				  return lhs.name < rhs.name;
+																			  });
+
+				/** Are the values of entriesByValue all distinct and contiguous? */
+				static constexpr bool		hasContiguousValues	= computeHasContiguousValues();
+
+				/**
+				*	@brief Find the index of the first entry in entriesByValue not smaller than the provided value.
+				* 
+				*	@param value The searched value.
+				* 
+				*	@return The index of the first entry not smaller than value, or the number of entries if there is none.
+				*/
+				RFK_NODISCARD static constexpr std::size_t	lowerBoundByValue(UnderlyingType value)	noexcept;
+
+				/**
+				*	@brief Find the index of the first entry in entriesByName not smaller than the provided name.
+				* 
+				*	@param name The searched name.
+				* 
+				*	@return The index of the first entry not smaller than name, or the number of entries if there is none.
+				*/
+				RFK_NODISCARD static constexpr std::size_t	lowerBoundByName(std::string_view name)	noexcept;
+		};
+	}
+
+	#include "Refureku/TypeInfo/Archetypes/EnumTable.inl"
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename EnumType>
+template <typename Compare>
+constexpr typename internal::EnumTableHelper<EnumType>::Entries internal::EnumTableHelper<EnumType>::sortEntries(Compare isLess) noexcept
+{
+	Entries result = EnumTable<EnumType>::entries;
+
+	//Insertion sort: stable, constexpr and fast enough for the size of an enum
+	for (std::size_t i = 1u; i < result.size(); i++)
+	{
+		EnumTableEntry<EnumType>	entry	= result[i];
+		std::size_t					j		= i;
+
+		for (; j > 0u && isLess(entry, result[j - 1u]); j--)
+		{
+			result[j] = result[j - 1u];
+		}
+
+		result[j] = entry;
+	}
+
+	return result;
+}
+
+template <typename EnumType>
+constexpr bool internal::EnumTableHelper<EnumType>::computeHasContiguousValues() noexcept
+{
+	for (std::size_t i = 1u; i < entriesByValue.size(); i++)
+	{
+		//Compare in the unsigned type so that incrementing the previous value can't overflow
+		if (static_cast<UnsignedType>(entriesByValue[i].value) != static_cast<UnsignedType>(static_cast<UnsignedType>(entriesByValue[i - 1u].value) + 1u))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename EnumType>
+constexpr std::size_t internal::EnumTableHelper<EnumType>::lowerBoundByValue(UnderlyingType value) noexcept
+{
+	std::size_t first = 0u;
+	std::size_t count = entriesByValue.size();
+
+	while (count > 0u)
+	{
+		std::size_t step = count / 2u;
+
+		if (static_cast<UnderlyingType>(entriesByValue[first + step].value) < value)
+		{
+			first += step + 1u;
+			count -= step + 1u;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+template <typename EnumType>
+constexpr std::size_t internal::EnumTableHelper<EnumType>::lowerBoundByName(std::string_view name) noexcept
+{
+	std::size_t first = 0u;
+	std::size_t count = entriesByName.size();
+
+	while (count > 0u)
+	{
+		std::size_t step = count / 2u;
+
+		if (entriesByName[first + step].name < name)
+		{
+			first += step + 1u;
+			count -= step + 1u;
+		}
+		else
+		{
+			count = step;
+		}
+	}
+
+	return first;
+}
+
+template <typename EnumType>
+constexpr std::string_view enumToString(EnumType value) noexcept
+{
+	using Helper			= internal::EnumTableHelper<EnumType>;
+	using UnderlyingType	= typename Helper::UnderlyingType;
+	using UnsignedType		= typename Helper::UnsignedType;
+
+	if constexpr (Helper::entriesByValue.size() == 0u)
+	{
+		return std::string_view();
+	}
+	else if constexpr (Helper::hasContiguousValues)
+	{
+		//Compute the offset in the unsigned type to handle the whole underlying type range
+		UnsignedType offset = static_cast<UnsignedType>(static_cast<UnsignedType>(value) - static_cast<UnsignedType>(Helper::entriesByValue[0].value));
+
+		return (offset < Helper::entriesByValue.size()) ? Helper::entriesByValue[offset].name : std::string_view();
+	}
+	else
+	{
+		std::size_t index = Helper::lowerBoundByValue(static_cast<UnderlyingType>(value));
+
+		return (index < Helper::entriesByValue.size() && Helper::entriesByValue[index].value == value) ? Helper::entriesByValue[index].name : std::string_view();
+	}
+}
+
+template <typename EnumType>
+constexpr std::optional<EnumType> stringToEnum(std::string_view name) noexcept
+{
+	using Helper = internal::EnumTableHelper<EnumType>;
+
+	std::size_t index = Helper::lowerBoundByName(name);
+
+	return (index < Helper::entriesByName.size() && Helper::entriesByName[index].name == name) ? std::optional<EnumType>(Helper::entriesByName[index].value) : std::nullopt;
+}
\ No newline at end of file
@@ -18,7 +18,7 @@ namespace rfk
 	class EnumValue final : public Entity
 	{
 		public:
-			REFUREKU_INTERNAL EnumValue(char const*		name,
+			REFUREKU_INTERNAL EnumValue(EntityName		name,
 										std::size_t		id,
 										int64			value,
 										Entity const*	outerEntity = nullptr)	noexcept;
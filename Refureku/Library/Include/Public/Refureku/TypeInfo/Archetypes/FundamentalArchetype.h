@@ -14,7 +14,7 @@ namespace rfk
 	class FundamentalArchetype final : public Archetype
 	{
 		public:
-			REFUREKU_INTERNAL FundamentalArchetype(char const*	name,
+			REFUREKU_INTERNAL FundamentalArchetype(EntityName	name,
 												   std::size_t	id,
 												   std::size_t	memorySize)	noexcept;
 			REFUREKU_INTERNAL ~FundamentalArchetype()						noexcept;
@@ -0,0 +1,106 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <utility>	//std::forward, std::move
+
+#include "Refureku/TypeInfo/Cast.h"
+#include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/Misc/SharedPtr.h"
+#include "Refureku/Misc/UniquePtr.h"
+
+namespace rfk
+{
+	//Forward declaration
+	class Struct;
+
+	/**
+	*	@brief	Handle to the instantiators of a struct taking a given set of arguments.
+	*			The instantiators are resolved once when the handle is retrieved with Struct::getInstantiator,
+	*			so the handle can be stored and used to make instances repeatedly without any lookup.
+	* 
+	*	@tparam InstantiatorSignature Signature of the instantiator, as ReturnType(ArgTypes...).
+	*/
+	template <typename InstantiatorSignature>
+	class InstantiatorHandle;
+
+	template <typename ReturnType, typename... ArgTypes>
+	class InstantiatorHandle<ReturnType(ArgTypes...)> final
+	{
+		private:
+			/** Struct the instances are made of. */
+			Struct const*		_archetype				= nullptr;
+
+			/** Archetype of ReturnType, used to adjust the instance pointers. Can be nullptr if ReturnType is not reflected. */
+			Struct const*		_returnTypeArchetype	= nullptr;
+
+			/** Shared instantiator taking ArgTypes... parameters, nullptr if none. */
+			StaticMethod const*	_sharedInstantiator		= nullptr;
+
+			/** Unique instantiator taking ArgTypes... parameters, nullptr if none. */
+			StaticMethod const*	_uniqueInstantiator		= nullptr;
+
+			InstantiatorHandle(Struct const&		archetype,
+							   Struct const*		returnTypeArchetype,
+							   StaticMethod const*	sharedInstantiator,
+							   StaticMethod const*	uniqueInstantiator)	noexcept;
+
+			/**
+			*	@brief Adjust a pointer to an instance of _archetype to a ReturnType pointer.
+			* 
+			*	@param instance The instance to adjust.
+			* 
+			*	@return The adjusted pointer.
+			*/
+			RFK_NODISCARD ReturnType*	adjustInstancePointer(ReturnType* instance)	const	noexcept;
+
+		public:
+			InstantiatorHandle() = default;
+
+			/**
+			*	@brief	Make an instance of the struct with the resolved instantiator.
+			*			Shared instantiators are used in priority, then unique instantiators.
+			* 
+			*	@param args Arguments forwarded to the instantiator. Value parameter types of the signature are taken as rvalue references.
+			* 
+			*	@return An instance of the struct if a suitable instantiator was found, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			SharedPtr<ReturnType>		makeSharedInstance(ArgTypes&&... args)	const;
+
+			/**
+			*	@brief Make an instance of the struct with the resolved unique instantiator.
+			* 
+			*	@param args Arguments forwarded to the instantiator. Value parameter types of the signature are taken as rvalue references.
+			* 
+			*	@return An instance of the struct if a suitable unique instantiator was found, else nullptr.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			UniquePtr<ReturnType>		makeUniqueInstance(ArgTypes&&... args)	const;
+
+			/**
+			*	@brief Check whether makeSharedInstance can make an instance.
+			* 
+			*	@return true if a shared or unique instantiator taking ArgTypes... was found, else false.
+			*/
+			RFK_NODISCARD bool			canMakeSharedInstance()						const	noexcept;
+
+			/**
+			*	@brief Check whether makeUniqueInstance can make an instance.
+			* 
+			*	@return true if a unique instantiator taking ArgTypes... was found, else false.
+			*/
+			RFK_NODISCARD bool			canMakeUniqueInstance()						const	noexcept;
+
+		friend Struct;
+	};
+
+	#include "Refureku/TypeInfo/Archetypes/InstantiatorHandle.inl"
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ReturnType, typename... ArgTypes>
+InstantiatorHandle<ReturnType(ArgTypes...)>::InstantiatorHandle(Struct const& archetype, Struct const* returnTypeArchetype,
+																 StaticMethod const* sharedInstantiator, StaticMethod const* uniqueInstantiator) noexcept:
+	_archetype{&archetype},
+	_returnTypeArchetype{returnTypeArchetype},
+	_sharedInstantiator{sharedInstantiator},
+	_uniqueInstantiator{uniqueInstantiator}
+{
+}
+
+template <typename ReturnType, typename... ArgTypes>
+ReturnType* InstantiatorHandle<ReturnType(ArgTypes...)>::adjustInstancePointer(ReturnType* instance) const noexcept
+{
+	return (_returnTypeArchetype != nullptr) ? rfk::dynamicUpCast<ReturnType>(instance, *_archetype, *_returnTypeArchetype) : instance;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+SharedPtr<ReturnType> InstantiatorHandle<ReturnType(ArgTypes...)>::makeSharedInstance(ArgTypes&&... args) const
+{
+	if (_sharedInstantiator != nullptr)
+	{
+		SharedPtr<ReturnType> result = _sharedInstantiator->invoke<SharedPtr<ReturnType>, ArgTypes...>(std::forward<ArgTypes>(args)...);
+
+		//Check if pointer needs to be adjusted here
+		ReturnType* ptr = result.get();
+		ReturnType* adjustedPtr = adjustInstancePointer(ptr);
+
+		if (ptr != adjustedPtr)
+		{
+			//Alias construct another shared pointer with the adjusted memory
+			return SharedPtr<ReturnType>(result, adjustedPtr);
+		}
+
+		return result;
+	}
+	else
+	{
+		//Try with unique instantiators
+		UniquePtr<ReturnType> uniqueInstance = makeUniqueInstance(std::forward<ArgTypes>(args)...);
+
+		return (uniqueInstance.get() != nullptr) ?
+				SharedPtr<ReturnType>(std::move(uniqueInstance)) :
+				nullptr;
+	}
+}
+
+template <typename ReturnType, typename... ArgTypes>
+UniquePtr<ReturnType> InstantiatorHandle<ReturnType(ArgTypes...)>::makeUniqueInstance(ArgTypes&&... args) const
+{
+	if (_uniqueInstantiator != nullptr)
+	{
+		UniquePtr<ReturnType> result = _uniqueInstantiator->invoke<UniquePtr<ReturnType>, ArgTypes...>(std::forward<ArgTypes>(args)...);
+
+		//Check if pointer needs to be adjusted here
+		ReturnType* ptr = result.get();
+		ReturnType* adjustedPtr = adjustInstancePointer(ptr);
+
+		if (ptr != adjustedPtr)
+		{
+			//Release previous pointer and feed the new adjusted one
+			result.release();
+			result.reset(adjustedPtr);
+		}
+
+		return result;
+	}
+	else
+	{
+		return nullptr;
+	}
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool InstantiatorHandle<ReturnType(ArgTypes...)>::canMakeSharedInstance() const noexcept
+{
+	return _sharedInstantiator != nullptr || _uniqueInstantiator != nullptr;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool InstantiatorHandle<ReturnType(ArgTypes...)>::canMakeUniqueInstance() const noexcept
+{
+	return _uniqueInstantiator != nullptr;
+}
\ No newline at end of file
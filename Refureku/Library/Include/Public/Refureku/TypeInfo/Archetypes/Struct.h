@@ -12,6 +12,7 @@
 
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
+#include "Refureku/TypeInfo/Archetypes/InstantiatorHandle.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"	//make[Unique/Shared]Instance<> uses StaticMethod wrapper so must include
 #include "Refureku/TypeInfo/Archetypes/EClassKind.h"
 #include "Refureku/TypeInfo/Variables/EFieldFlags.h"
@@ -31,6 +32,7 @@ namespace rfk
 	class Method;
 	class Type;
 	class ICallable;
+	class Database;
 	class Struct;
 	
 	/* In C++, a struct and a class contain exactly the same data. Alias for convenience. */
@@ -39,7 +41,7 @@ namespace rfk
 	class Struct : public Archetype
 	{
 		public:
-			REFUREKU_API Struct(char const*	name,
+			REFUREKU_API Struct(EntityName	name,
 								std::size_t	id,
 								std::size_t	memorySize,
 								bool		isClass)	noexcept;
@@ -73,6 +75,19 @@ namespace rfk
 			RFK_NODISCARD 
 				rfk::UniquePtr<ReturnType>			makeUniqueInstance(ArgTypes&&... args)												const;
 
+			/**
+			*	@brief	Get a handle to the instantiators of this struct taking the provided argument types.
+			*			The instantiators are resolved once per struct and signature, and the returned handle
+			*			can be stored to make instances repeatedly without any lookup.
+			* 
+			*	@tparam InstantiatorSignature Signature of the instantiators as ReturnType(ArgTypes...), ReturnType being the type of the made instances.
+			*
+			*	@return A handle to the instantiators taking ArgTypes... parameters. If there is none, the handle makes nullptr instances.
+			*/
+			template <typename InstantiatorSignature>
+			RFK_NODISCARD 
+				InstantiatorHandle<InstantiatorSignature>	getInstantiator()																const	noexcept;
+
 			/**
 			*	@brief	Compute the list of all direct reflected subclasses of this struct.
 			*			Direct subclasses are computed by iterating over all subclasses (direct or not), so this method
@@ -100,9 +115,20 @@ namespace rfk
 			* 
 			*	@return true if this struct is a base class of the provided archetype, else false.
 			*			Note that if the provided archetype is the same as this struct, true is returned.
+			* 
+			*	@note Runs in constant time if no struct in the reflected hierarchy of the provided archetype has multiple reflected parents.
 			*/
 			RFK_NODISCARD REFUREKU_API bool			isBaseOf(Struct const& archetype)													const	noexcept;
 
+			/**
+			*	@brief	Check if a pointer to an instance of this struct is also a valid pointer to any of its reflected parents, recursively.
+			*			It is the case if each struct of the reflected hierarchy has at most one reflected direct parent,
+			*			and each parent is located at offset 0 in its subclasses.
+			* 
+			*	@return true if casting this struct to any of its reflected parents never requires a pointer adjustment, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool			hasZeroPointerOffsetParents()														const	noexcept;
+
 			/**
 			*	@brief	Get the index'th direct parent of this struct.
 			*			If index is greater or equal to getDirectParentsCount(), the behaviour is undefined.
@@ -322,7 +348,8 @@ namespace rfk
 																		 bool				orderedByDeclaration = false)				const;
 
 			/**
-			*	@brief Execute the given visitor on all fields in this struct.
+			*	@brief	Execute the given visitor on all fields in this struct.
+			*			Fields are visited in registration order, which is the declaration order for generated code.
 			* 
 			*	@param visitor					Visitor function to call. Return false to abort the foreach loop.
 			*	@param userData					Optional user data forwarded to the visitor.
@@ -398,7 +425,8 @@ namespace rfk
 																			   bool						shouldInspectInherited = false)	const;
 
 			/**
-			*	@brief Execute the given visitor on all static fields in this struct.
+			*	@brief	Execute the given visitor on all static fields in this struct.
+			*			Static fields are visited in registration order, which is the declaration order for generated code.
 			* 
 			*	@param visitor					Visitor function to call. Return false to abort the foreach loop.
 			*	@param userData					Optional user data forwarded to the visitor.
@@ -507,7 +535,8 @@ namespace rfk
 																		  bool				shouldInspectInherited = false)				const;
 
 			/**
-			*	@brief Execute the given visitor on all methods in this struct.
+			*	@brief	Execute the given visitor on all methods in this struct.
+			*			Methods are visited in registration order, which is the declaration order for generated code.
 			* 
 			*	@param visitor					Visitor function to call. Return false to abort the foreach loop.
 			*	@param userData					Optional user data forwarded to the visitor.
@@ -615,7 +644,8 @@ namespace rfk
 																				bool					shouldInspectInherited = false)	const;
 
 			/**
-			*	@brief Execute the given visitor on all static methods in this struct.
+			*	@brief	Execute the given visitor on all static methods in this struct.
+			*			Static methods are visited in registration order, which is the declaration order for generated code.
 			* 
 			*	@param visitor					Visitor function to call. Return false to abort the foreach loop.
 			*	@param userData					Optional user data forwarded to the visitor.
@@ -721,10 +751,10 @@ namespace rfk
 			*	@param outerEntity	Struct the field was first declared in (in case of inherited field, outerEntity is the parent struct).
 			*	
 			*	@return A pointer to the added field.
-			*			The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*			The pointer stays valid as long as the struct is alive.
 			*			If any of the parameters is unvalid, no field is added and nullptr is returned.
 			*/
-			REFUREKU_API Field*						addField(char const*	name,
+			REFUREKU_API Field*						addField(EntityName	name,
 															 std::size_t	id,
 															 Type const&	type,
 															 EFieldFlags	flags,
@@ -750,16 +780,16 @@ namespace rfk
 			*	@param outerEntity	Struct the field was first declared in (in case of inherited field, outerEntity is the parent struct).
 			*	
 			*	@return A pointer to the added static field.
-			*			The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*			The pointer stays valid as long as the struct is alive.
 			*			If any of the parameters is unvalid, no static field is added and nullptr is returned.
 			*/
-			REFUREKU_API StaticField*				addStaticField(char const*		name,
+			REFUREKU_API StaticField*				addStaticField(EntityName		name,
 																   std::size_t		id,
 																   Type const&		type,
 																   EFieldFlags		flags,
 																   void*			fieldPtr,
 																   Struct const*	outerEntity)												noexcept;
-			REFUREKU_API StaticField*				addStaticField(char const*		name,
+			REFUREKU_API StaticField*				addStaticField(EntityName		name,
 																   std::size_t		id,
 																   Type const&		type,
 																   EFieldFlags		flags,
@@ -783,10 +813,10 @@ namespace rfk
 			*	@param internalMethod	Dynamically allocated MemberFunction storing the underlying method.
 			*	@param flags			Method flags.
 			*
-			*	@return A pointer to the added method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added method. The pointer stays valid as long as the struct is alive.
 			*			If any of the parameters is unvalid, no method is added and nullptr is returned.
 			*/
-			REFUREKU_API Method*					addMethod(char const*	name,
+			REFUREKU_API Method*					addMethod(EntityName	name,
 															  std::size_t	id,
 															  Type const&	returnType,
 															  ICallable*	internalMethod,
@@ -809,10 +839,10 @@ namespace rfk
 			*	@param internalMethod	Dynamically allocated NonMemberFunction storing the underlying static method.
 			*	@param flags			Method flags.
 			*
-			*	@return A pointer to the added static method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
+			*	@return A pointer to the added static method. The pointer stays valid as long as the struct is alive.
 			*			If any of the parameters is unvalid, no static method is added and nullptr is returned.
 			*/
-			REFUREKU_API StaticMethod*				addStaticMethod(char const*		name,
+			REFUREKU_API StaticMethod*				addStaticMethod(EntityName		name,
 																	std::size_t		id,
 																	Type const&		returnType,
 																	ICallable*		internalMethod,
@@ -848,7 +878,7 @@ namespace rfk
 			//Forward declaration
 			class StructImpl;
 
-			REFUREKU_INTERNAL Struct(char const*	name,
+			REFUREKU_INTERNAL Struct(EntityName	name,
 									 std::size_t	id,
 									 std::size_t	memorySize,
 									 bool			isClass,
@@ -858,6 +888,46 @@ namespace rfk
 			RFK_GEN_GET_PIMPL(StructImpl, Entity::getPimpl())
 
 		private:
+			/**
+			*	@brief Resolve the instantiators of this struct taking ArgTypes... parameters.
+			* 
+			*	@return A handle to the instantiators taking ArgTypes... parameters.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD 
+				InstantiatorHandle<ReturnType(ArgTypes...)>	getInstantiator(ReturnType (*)(ArgTypes...))						const	noexcept;
+
+			/**
+			*	@brief	Retrieve the instantiators previously resolved for a parameters fingerprint.
+			*			/!\ This method is called from template methods so it must be exported.
+			* 
+			*	@param parametersFingerprint	Fingerprint of the instantiators parameter types.
+			*	@param out_sharedInstantiator	Resolved shared instantiator if found, can be nullptr.
+			*	@param out_uniqueInstantiator	Resolved unique instantiator if found, can be nullptr.
+			*	@param out_generation			Generation of the instantiators of this struct, to provide to memoizeInstantiators.
+			* 
+			*	@return true if instantiators were resolved for the provided fingerprint, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool	getMemoizedInstantiators(uint64					parametersFingerprint,
+																	 StaticMethod const*&	out_sharedInstantiator,
+																	 StaticMethod const*&	out_uniqueInstantiator,
+																	 uint64&				out_generation)			const	noexcept;
+
+			/**
+			*	@brief	Remember the instantiators resolved for a parameters fingerprint, even if none was found.
+			*			/!\ This method is called from template methods so it must be exported.
+			* 
+			*	@param parametersFingerprint	Fingerprint of the instantiators parameter types.
+			*	@param sharedInstantiator		Resolved shared instantiator, can be nullptr.
+			*	@param uniqueInstantiator		Resolved unique instantiator, can be nullptr.
+			*	@param generation				Generation retrieved by getMemoizedInstantiators before resolving the instantiators.
+			*									Nothing is memoized if instantiators were added since then.
+			*/
+			REFUREKU_API void				memoizeInstantiators(uint64					parametersFingerprint,
+																 StaticMethod const*	sharedInstantiator,
+																 StaticMethod const*	uniqueInstantiator,
+																 uint64					generation)					const	noexcept;
+
 			/**
 			*	@brief Execute the given visitor on all shared instantiators taking a given number of parameters in this struct.
 			* 
@@ -889,6 +959,8 @@ namespace rfk
 			REFUREKU_API bool	foreachUniqueInstantiator(std::size_t			argCount,
 														  Visitor<StaticMethod>	visitor,
 														  void*					userData)	const;
+
+		friend Database;
 	};
 
 	REFUREKU_TEMPLATE_API(rfk::Allocator<Struct const*>);
@@ -9,51 +9,8 @@ template <typename ReturnType, typename... ArgTypes>
 rfk::SharedPtr<ReturnType> Struct::makeSharedInstance(ArgTypes&&... args) const
 {
 	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeSharedInstance should not be a pointer or a reference.");
-	
-	StaticMethod const* instantiator;
 
-	if (!foreachSharedInstantiator(sizeof...(args), [](StaticMethod const& instantiator, void* data)
-		{
-			//Find a shared instantiator with the same parameters
-			if (instantiator.hasSameParameters<ArgTypes...>())
-			{
-				*reinterpret_cast<StaticMethod const**>(data) = &instantiator;
-				return false;
-			}
-
-			return true;
-		}, &instantiator))
-	{
-		assert(instantiator != nullptr);
-
-		SharedPtr<ReturnType> result = instantiator->invoke<SharedPtr<ReturnType>>(std::forward<ArgTypes>(args)...);
-
-		Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
-
-		if (returnTypeArchetype != nullptr)
-		{
-			//Check if pointer needs to be adjusted here
-			ReturnType* ptr = result.get();
-			ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
-
-			if (ptr != adjustedPtr)
-			{
-				//Alias construct another shared pointer with the adjusted memory
-				return SharedPtr<ReturnType>(result, adjustedPtr);
-			}
-		}
-
-		return result;
-	}
-	else
-	{
-		//Try with unique instantiators
-		rfk::UniquePtr<ReturnType> uniqueInstance = makeUniqueInstance<ReturnType>(std::forward<ArgTypes>(args)...);
-
-		return (uniqueInstance.get() != nullptr) ?
-				rfk::SharedPtr<ReturnType>(std::move(uniqueInstance)) :
-				nullptr;
-	}
+	return getInstantiator<ReturnType(ArgTypes...)>().makeSharedInstance(std::forward<ArgTypes>(args)...);
 }
 
 template <typename ReturnType, typename... ArgTypes>
@@ -61,9 +18,27 @@ rfk::UniquePtr<ReturnType> Struct::makeUniqueInstance(ArgTypes&&... args) const
 {
 	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeUniqueInstance should not be a pointer or a reference.");
 
-	StaticMethod const* instantiator;
+	return getInstantiator<ReturnType(ArgTypes...)>().makeUniqueInstance(std::forward<ArgTypes>(args)...);
+}
+
+template <typename InstantiatorSignature>
+InstantiatorHandle<InstantiatorSignature> Struct::getInstantiator() const noexcept
+{
+	//Deduce the return and argument types from the signature
+	return getInstantiator(static_cast<InstantiatorSignature*>(nullptr));
+}
+
+template <typename ReturnType, typename... ArgTypes>
+InstantiatorHandle<ReturnType(ArgTypes...)> Struct::getInstantiator(ReturnType (*)(ArgTypes...)) const noexcept
+{
+	uint64 const		parametersFingerprint = FunctionBase::computeSignatureFingerprint<void, ArgTypes...>();
+	StaticMethod const*	sharedInstantiator;
+	StaticMethod const*	uniqueInstantiator;
+	uint64				instantiatorsGeneration;
 
-	if (!foreachUniqueInstantiator(sizeof...(args), [](StaticMethod const& instantiator, void* data)
+	if (!getMemoizedInstantiators(parametersFingerprint, sharedInstantiator, uniqueInstantiator, instantiatorsGeneration))
+	{
+		auto visitor = [](StaticMethod const& instantiator, void* data)
 		{
 			//Find an instantiator with the same parameters
 			if (instantiator.hasSameParameters<ArgTypes...>())
@@ -73,34 +48,19 @@ rfk::UniquePtr<ReturnType> Struct::makeUniqueInstance(ArgTypes&&... args) const
 			}
 
 			return true;
-		}, &instantiator))
-	{
-		assert(instantiator != nullptr);
-
-		UniquePtr<ReturnType> result = instantiator->invoke<UniquePtr<ReturnType>>(std::forward<ArgTypes>(args)...);
+		};
 
-		Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
+		sharedInstantiator = nullptr;
+		uniqueInstantiator = nullptr;
 
-		if (returnTypeArchetype != nullptr)
-		{
-			//Check if pointer needs to be adjusted here
-			ReturnType* ptr = result.get();
-			ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
+		foreachSharedInstantiator(sizeof...(ArgTypes), visitor, &sharedInstantiator);
+		foreachUniqueInstantiator(sizeof...(ArgTypes), visitor, &uniqueInstantiator);
 
-			if (ptr != adjustedPtr)
-			{
-				//Release previous pointer and feed the new adjusted one
-				result.release();
-				result.reset(adjustedPtr);
-			}
-		}
-
-		return result;
-	}
-	else
-	{
-		return nullptr;
+		//Not memoized if instantiators were added while resolving, the result is still valid for this call
+		memoizeInstantiators(parametersFingerprint, sharedInstantiator, uniqueInstantiator, instantiatorsGeneration);
 	}
+
+	return InstantiatorHandle<ReturnType(ArgTypes...)>(*this, static_cast<Struct const*>(rfk::getArchetype<ReturnType>()), sharedInstantiator, uniqueInstantiator);
 }
 
 template <typename MethodSignature>
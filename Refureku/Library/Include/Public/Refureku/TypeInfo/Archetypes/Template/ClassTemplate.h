@@ -23,7 +23,7 @@ namespace rfk
 	class ClassTemplate final : public Struct
 	{
 		public:
-			REFUREKU_API ClassTemplate(char const*	name,
+			REFUREKU_API ClassTemplate(EntityName	name,
 									   std::size_t	id,
 									   bool			isClass)	noexcept;
 			REFUREKU_API ~ClassTemplate()						noexcept;
@@ -60,11 +60,12 @@ namespace rfk
 
 			/**
 			*	@brief	Get an existing template instantiation corresponding to the provided arguments.
+			*			nullptr arguments are wildcards matching any argument.
 			* 
 			*	@param args			Pointer to an array of argument pointers
 			*	@param argsCount	Number of template arguments.
 			* 
-			*	@return The found class template instantiation corresponding to the provided arguments if it exists, else nullptr.
+			*	@return The first registered class template instantiation corresponding to the provided arguments if it exists, else nullptr.
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				ClassTemplateInstantiation const*	getTemplateInstantiation(TemplateArgument const**	args,
@@ -118,6 +119,9 @@ namespace rfk
 			class ClassTemplateImpl;
 
 			RFK_GEN_GET_PIMPL(ClassTemplateImpl, Entity::getPimpl())
+
+			//Instantiations invalidate the template instantiations indices when their template arguments change
+			friend ClassTemplateInstantiation;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.inl"
@@ -22,7 +22,7 @@ namespace rfk
 	class ClassTemplateInstantiation final : public Struct
 	{
 		public:
-			REFUREKU_API ClassTemplateInstantiation(char const*			name,
+			REFUREKU_API ClassTemplateInstantiation(EntityName			name,
 													   std::size_t		id,
 													   std::size_t		memorySize,
 													   bool				isClass,
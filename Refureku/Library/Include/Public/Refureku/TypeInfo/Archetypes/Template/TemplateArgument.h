@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>	//std::size_t
+
 #include "Refureku/Config.h"
 #include "Refureku/Misc/Pimpl.h"
 #include "Refureku/Misc/GetPimplMacro.h"
@@ -50,5 +52,15 @@ namespace rfk
 		private:
 			/** Pointer to the concrete TemplateParameter implementation. */
 			Pimpl<TemplateArgumentImpl>	_pimpl;
+
+			//Class templates index their instantiations by the hash of their template arguments
+			friend class ClassTemplate;
+
+			/**
+			*	@brief Compute a hash of this template argument.
+			* 
+			*	@return The computed hash. Equal template arguments have the same hash.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL std::size_t	computeHash()	const	noexcept;
 	};
 }
\ No newline at end of file
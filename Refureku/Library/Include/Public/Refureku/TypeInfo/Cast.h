@@ -8,10 +8,12 @@
 #pragma once
 
 #include <type_traits> //std::is_class_v, is_base_of_v
+#include <cstddef>		//std::ptrdiff_t
 #include <cassert>
 
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 #include "Refureku/Misc/CopyConstness.h"
+#include "Refureku/Misc/FundamentalTypes.h"
 #include "Refureku/Misc/TypeTraits.h"	//isCallable_static_staticGetArchetype, isCallable_getArchetype
 
 namespace rfk
@@ -21,6 +23,8 @@ namespace rfk
 
 	/**
 	*	@brief	Adjust the provided pointer to another class pointer if possible.
+	*			The result of the last cast is cached per thread for each TargetClassType/SourceClassType pair and is reused
+	*			as long as the dynamic archetype of the instance doesn't change, so monomorphic casts only cost a pointer comparison.
 	* 
 	*	@tparam TargetClassType Type to cast to.
 	*	@tparam SourceClassType Static type of the provided instance to cast.
@@ -89,6 +93,36 @@ namespace rfk
 
 	namespace internal
 	{
+		/**
+		*	@brief	Result of the last cast performed by a rfk::dynamicCast<TargetClassType, SourceClassType> instantiation.
+		*			Since virtual inheritance is not supported, the pointer offset only depends on the dynamic archetype of the instance.
+		*/
+		struct DynamicCastCacheEntry
+		{
+			/** Dynamic archetype of the last casted instance. */
+			Struct const*	dynamicArchetype		= nullptr;
+
+			/** Offset to add to a SourceClassType pointer to get a TargetClassType pointer. */
+			std::ptrdiff_t	pointerOffset			= 0;
+
+			/** Whether the cast of an instance of dynamicArchetype is successful or not. */
+			bool			isSuccessful			= false;
+
+			/**
+			*	Database registration generation when the entry was resolved.
+			*	The entry is a miss when it differs from the current one since dynamicArchetype might have been unloaded and its address reused.
+			*/
+			uint64			registrationGeneration	= 0u;
+		};
+
+		/**
+		*	@brief	Retrieve the database registration generation, which changes each time entities are registered to or unregistered from the database.
+		*			/!\ This function is called from template functions so it must be exported.
+		* 
+		*	@return The current database registration generation.
+		*/
+		RFK_NODISCARD REFUREKU_API uint64		getDatabaseRegistrationGeneration()			noexcept;
+
 		/**
 		*	@brief	Adjust the provided pointer to another class pointer if possible.
 		* 
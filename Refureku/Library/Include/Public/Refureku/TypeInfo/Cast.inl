@@ -13,9 +13,32 @@ TargetClassType* dynamicCast(SourceClassType* instance) noexcept
 	static_assert(internal::isCallable_static_staticGetArchetype<SourceClassType, Struct const&()>::value, "[Refureku] The instance to cast must implement the staticGetArchetype static method.");
 	static_assert(internal::isCallable_getArchetype<SourceClassType, Struct const&()>::value, "[Refureku] The instance to cast must override the virtual getArchetype method.");
 
-	Struct const* targetArchetype = static_cast<Struct const*>(getArchetype<TargetClassType>());
+	if (instance == nullptr)
+	{
+		return nullptr;
+	}
 
-	return (targetArchetype != nullptr) ? dynamicCast<TargetClassType>(instance, SourceClassType::staticGetArchetype(), instance->getArchetype(), *targetArchetype) : nullptr;
+	thread_local internal::DynamicCastCacheEntry cache;
+
+	Struct const&	instanceDynamicArchetype	= instance->getArchetype();
+	uint64			registrationGeneration		= internal::getDatabaseRegistrationGeneration();
+
+	//Resolve the cast only when the dynamic archetype differs from the last casted instance one,
+	//or when entities were (un)registered since: the cached archetype might have been unloaded and replaced at the same address
+	if (cache.dynamicArchetype != &instanceDynamicArchetype || cache.registrationGeneration != registrationGeneration)
+	{
+		Struct const*	targetArchetype	= static_cast<Struct const*>(getArchetype<TargetClassType>());
+		void const*		result			= (targetArchetype != nullptr) ?
+											internal::dynamicCast(static_cast<void const*>(instance), SourceClassType::staticGetArchetype(), instanceDynamicArchetype, *targetArchetype) :
+											nullptr;
+
+		cache.isSuccessful				= (result != nullptr);
+		cache.pointerOffset				= cache.isSuccessful ? reinterpret_cast<char const*>(result) - reinterpret_cast<char const*>(instance) : 0;
+		cache.dynamicArchetype			= &instanceDynamicArchetype;
+		cache.registrationGeneration	= registrationGeneration;
+	}
+
+	return cache.isSuccessful ? reinterpret_cast<TargetClassType*>(reinterpret_cast<typename CopyConstness<SourceClassType, char>::Type*>(instance) + cache.pointerOffset) : nullptr;
 }
 
 template <typename TargetClassType>
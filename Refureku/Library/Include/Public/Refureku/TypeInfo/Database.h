@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
 #include "Refureku/Misc/Pimpl.h"
 #include "Refureku/Misc/Visitor.h"
 #include "Refureku/Misc/Predicate.h"
@@ -41,6 +44,8 @@ namespace rfk
 		class ArchetypeRegistererImpl;
 		class NamespaceFragmentRegistererImpl;
 		class ClassTemplateInstantiationRegistererImpl;
+
+		REFUREKU_API uint64 getDatabaseRegistrationGeneration() noexcept;
 	}
 
 	class Database final
@@ -51,6 +56,25 @@ namespace rfk
 			Database(Database&&)			= delete;
 			REFUREKU_INTERNAL ~Database()	noexcept;
 
+			/**
+			*	@brief	Lock the database for writing until endRegistrationBatch is called from the same thread.
+			*			All entities registered or unregistered by the calling thread in between (typically by loading or unloading
+			*			a dynamic library) are published atomically: other threads either see none or all of them.
+			*			/!\ The write lock is held for the whole batch: every thread querying the database blocks until the batch ends,
+			*			so the calling thread must not wait for another thread querying the database before ending the batch.
+			*			Without a batch, each file level entity is published under its own short write lock, so readers only wait
+			*			for the registration of one entity at a time but can observe a partially loaded module.
+			*			Calls can be nested.
+			*/
+			REFUREKU_API static void			beginRegistrationBatch()														noexcept;
+
+			/**
+			*	@brief	End a registration batch previously started by the calling thread with beginRegistrationBatch.
+			*			The write lock is released (and the readers blocked since beginRegistrationBatch resume)
+			*			when the outermost batch ends.
+			*/
+			REFUREKU_API static void			endRegistrationBatch()															noexcept;
+
 			/**
 			*	@brief Retrieve an entity by id.
 			*
@@ -61,6 +85,48 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API 
 				Entity const*				getEntityById(std::size_t id)													const	noexcept;
 
+			/**
+			*	@brief	Retrieve an entity by its fully qualified name, using :: as a separator.
+			*			Namespaces, archetypes (including nested archetypes), non-member variables, non-member functions, enum values
+			*			and struct members (fields, static fields, methods, static methods) can be retrieved.
+			*			Example: getEntityByQualifiedName("namespace1::Outer::Inner") will get the Inner archetype nested inside namespace1::Outer if it exists.
+			*			If several functions or methods share the queried name, any of them is returned.
+			*			This method doesn't allocate any memory.
+			*
+			*	@param qualifiedName The fully qualified name of the entity.
+			*
+			*	@return A constant pointer to the queried entity if it exists and the name is well formed, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Entity const*				getEntityByQualifiedName(std::string_view qualifiedName)						const	noexcept;
+
+			/**
+			*	@brief	Retrieve all registered entities carrying a property of a given type, in no particular order.
+			*			The database keeps a reverse index of the properties attached to registered entities,
+			*			so the cost of this method only depends on the number of returned entities.
+			*
+			*	@tparam PropertyType Type of the property to look for. It must inherit from rfk::Property.
+			*
+			*	@param isChildClassValid If true, also retrieve entities carrying properties inheriting from PropertyType.
+			*
+			*	@return All registered entities carrying a property of type PropertyType.
+			*/
+			template <typename PropertyType>
+			RFK_NODISCARD Vector<Entity const*>	getEntitiesWithProperty(bool isChildClassValid = true)							const	noexcept;
+
+			/**
+			*	@brief	Retrieve all registered entities carrying a property matching the provided archetype, in no particular order.
+			*			Properties added to an entity after it has been registered are not taken into account.
+			*
+			*	@param archetype			Archetype of the property to look for.
+			*	@param isChildClassValid	If true, also retrieve entities carrying properties inheriting from archetype.
+			*
+			*	@return All registered entities carrying a property matching the provided archetype.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				Vector<Entity const*>			getEntitiesWithProperty(Struct const&	archetype,
+																		bool			isChildClassValid = true)		const	noexcept;
+
 			/**
 			*	@brief Retrieve a namespace by id.
 			*
@@ -84,6 +150,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				Namespace const*				getNamespaceByName(char const* name)											const;
+			RFK_NODISCARD REFUREKU_API 
+				Namespace const*				getNamespaceByName(std::string_view name)										const;
 
 			/**
 			*	@brief Retrieve the first file level namespace satisfying the provided predicate.
@@ -155,6 +223,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				Archetype const*				getFileLevelArchetypeByName(char const* name)									const	noexcept;
+			RFK_NODISCARD REFUREKU_API 
+				Archetype const*				getFileLevelArchetypeByName(std::string_view name)								const	noexcept;
 
 			/**
 			*	@brief Retrieve all file level archetypes satisfying the provided predicate.
@@ -189,6 +259,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				Struct const*					getFileLevelStructByName(char const* name)										const	noexcept;
+			RFK_NODISCARD REFUREKU_API 
+				Struct const*					getFileLevelStructByName(std::string_view name)									const	noexcept;
 
 			/**
 			*	@brief Retrieve the first level struct satisfying the provided predicate.
@@ -258,6 +330,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				Class const*					getFileLevelClassByName(char const* name)										const	noexcept;
+			RFK_NODISCARD REFUREKU_API 
+				Class const*					getFileLevelClassByName(std::string_view name)									const	noexcept;
 
 			/**
 			*	@brief Retrieve the first level struct satisfying the provided predicate.
@@ -327,6 +401,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				Enum const*						getFileLevelEnumByName(char const* name)										const	noexcept;
+			RFK_NODISCARD REFUREKU_API 
+				Enum const*						getFileLevelEnumByName(std::string_view name)									const	noexcept;
 
 			/**
 			*	@brief Retrieve the first file level enum satisfying the provided predicate.
@@ -396,6 +472,8 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API 
 				FundamentalArchetype const*		getFundamentalArchetypeByName(char const* name)									const	noexcept;
+			RFK_NODISCARD REFUREKU_API 
+				FundamentalArchetype const*		getFundamentalArchetypeByName(std::string_view name)							const	noexcept;
 
 			/**
 			*	@brief Retrieve a variable by id.
@@ -635,9 +713,11 @@ namespace rfk
 		friend internal::DefaultEntityRegistererImpl;
 		friend internal::ArchetypeRegistererImpl;
 		friend internal::NamespaceFragmentRegistererImpl;
+		friend Namespace;
 		friend NamespaceFragment;
 		friend internal::ClassTemplateInstantiationRegistererImpl;
 		friend REFUREKU_API Database const& getDatabase() noexcept;
+		friend REFUREKU_API uint64 internal::getDatabaseRegistrationGeneration() noexcept;
 	};
 
 	/**
@@ -5,6 +5,12 @@
 *	See the LICENSE.md file for full license details.
 */
 
+template <typename PropertyType>
+Vector<Entity const*> Database::getEntitiesWithProperty(bool isChildClassValid) const noexcept
+{
+	return getEntitiesWithProperty(PropertyType::staticGetArchetype(), isChildClassValid);
+}
+
 template <typename FunctionSignature>
 Function const* Database::getFileLevelFunctionByName(char const* name, EFunctionFlags flags) const noexcept
 {
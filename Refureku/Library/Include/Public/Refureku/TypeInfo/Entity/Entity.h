@@ -14,6 +14,7 @@
 #include "Refureku/Misc/Pimpl.h"
 #include "Refureku/Misc/GetPimplMacro.h"
 #include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/Entity/EntityName.h"
 #include "Refureku/Properties/Property.h"
 #include "Refureku/Misc/Visitor.h"
 #include "Refureku/Misc/Predicate.h"
@@ -67,6 +68,31 @@ namespace rfk
 				Property const*				getProperty(Struct const&	archetype,
 														bool			isChildClassValid = true)		const	noexcept;
 
+			/**
+			*	@brief Check whether a property of a given type is attached to this entity.
+			*	
+			*	@tparam PropertyType Type of the property to look for. It must inherit from rfk::Property.
+			* 
+			*	@param isChildClassValid If true, consider properties inheriting from the provided property type valid.
+			*	
+			*	@return true if a property of type PropertyType is attached to this entity, else false.
+			*/
+			template <typename PropertyType, typename = std::enable_if_t<std::is_base_of_v<Property, PropertyType> && !std::is_same_v<PropertyType, Property>>>
+			RFK_NODISCARD
+				bool						hasProperty(bool isChildClassValid = true)					const	noexcept;
+
+			/**
+			*	@brief Check whether a property matching the provided archetype is attached to this entity.
+			*	
+			*	@param archetype			Archetype of the property to look for.
+			*	@param isChildClassValid	If true, consider properties inheriting from the provided archetype valid.
+			*	
+			*	@return true if a property matching the provided archetype is attached to this entity, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				bool						hasProperty(Struct const&	archetype,
+														bool			isChildClassValid = true)		const	noexcept;
+
 			/**
 			*	@brief Retrieve the first property named with the provided name.
 			* 
@@ -171,6 +197,15 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API
 				char const*					getName()													const	noexcept;
 
+			/**
+			*	@brief	Get the hash of the name of the entity.
+			*			The hash is computed once when the entity is created and is equal to std::hash<std::string_view>()(getName()).
+			* 
+			*	@return The hash of the name of the entity.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t					getNameHash()												const	noexcept;
+
 			/**
 			*	@brief Check that this entity has the same name as the provided string.
 			* 
@@ -13,6 +13,12 @@ PropertyType const* Entity::getProperty(bool isChildClassValid) const noexcept
 	return reinterpret_cast<PropertyType const*>(getProperty(PropertyType::staticGetArchetype(), isChildClassValid));
 }
 
+template <typename PropertyType, typename>
+bool Entity::hasProperty(bool isChildClassValid) const noexcept
+{
+	return hasProperty(PropertyType::staticGetArchetype(), isChildClassValid);
+}
+
 template <typename PropertyType, typename>
 Vector<PropertyType const*> Entity::getProperties(bool isChildClassValid) const noexcept
 {
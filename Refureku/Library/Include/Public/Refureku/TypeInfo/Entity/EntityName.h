@@ -0,0 +1,92 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+
+namespace rfk
+{
+	/**
+	*	Name given to an entity when it is registered.
+	*	Names implicitly built from a char const* are copied by the entity, so they can be built dynamically.
+	*	Names built with fromLiteral from a string literal are referenced without being copied, which saves an allocation and the storage of the copy.
+	*	The generated code registers all its names this way. A literal lives as long as the module (executable or dynamic library) it is compiled in,
+	*	so modules that can be unloaded while their entities are still reachable must be compiled with RFK_COPY_LITERAL_ENTITY_NAMES.
+	*/
+	class EntityName
+	{
+		private:
+			/** Null-terminated name characters. */
+			char const*	_data;
+
+			/** Number of characters of the name, null terminator excluded. */
+			std::size_t	_length;
+
+			/** Does the name outlive the entity it is given to? */
+			bool		_isStatic;
+
+			constexpr EntityName(char const*	data,
+								 std::size_t	length,
+								 bool			isStatic)	noexcept;
+
+			/**
+			*	@brief Get the number of characters preceding the first null terminator of a char array.
+			* 
+			*	@param chars	Char array to search.
+			*	@param size		Number of elements of the array.
+			* 
+			*	@return The index of the first null terminator, size if the array contains none.
+			*/
+			static constexpr std::size_t	findNullTerminator(char const*	chars,
+															   std::size_t	size)		noexcept;
+
+		public:
+			/**
+			*	@param name Null-terminated name, copied by the entity it is given to. Can be nullptr.
+			*/
+			REFUREKU_API EntityName(char const* name)	noexcept;
+
+			/**
+			*	@brief	Make a name referencing a string literal, which is not copied by the entity it is given to.
+			*			Arrays which are not a plain string literal (partially filled buffer, embedded or missing null terminator)
+			*			are copied up to their first null terminator instead, as is every name when RFK_COPY_LITERAL_ENTITY_NAMES is set.
+			*			/!\ The provided array must outlive the entity, which is the case of a string literal as long as its module is loaded.
+			* 
+			*	@param literal String literal of the name.
+			* 
+			*	@return The name.
+			*/
+			template <std::size_t Length>
+			RFK_NODISCARD static constexpr EntityName	fromLiteral(char const (&literal)[Length])	noexcept;
+
+			/**
+			*	@brief Get the null-terminated name characters.
+			* 
+			*	@return The name characters, nullptr if the name was built from nullptr.
+			*/
+			RFK_NODISCARD constexpr char const*			getData()							const	noexcept;
+
+			/**
+			*	@brief Get the number of characters of the name, null terminator excluded.
+			* 
+			*	@return The length of the name.
+			*/
+			RFK_NODISCARD constexpr std::size_t			getLength()							const	noexcept;
+
+			/**
+			*	@brief Check whether the name outlives the entity it is given to, in which case it is not copied.
+			* 
+			*	@return true if the name is referenced without being copied, else false.
+			*/
+			RFK_NODISCARD constexpr bool				isStatic()							const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Entity/EntityName.inl"
+}
\ No newline at end of file
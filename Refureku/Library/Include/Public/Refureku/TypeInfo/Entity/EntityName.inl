@@ -0,0 +1,53 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr EntityName::EntityName(char const* data, std::size_t length, bool isStatic) noexcept:
+	_data{data},
+	_length{length},
+	_isStatic{isStatic}
+{
+}
+
+constexpr std::size_t EntityName::findNullTerminator(char const* chars, std::size_t size) noexcept
+{
+	for (std::size_t i = 0u; i < size; i++)
+	{
+		if (chars[i] == '\0')
+		{
+			return i;
+		}
+	}
+
+	return size;
+}
+
+template <std::size_t Length>
+constexpr EntityName EntityName::fromLiteral(char const (&literal)[Length]) noexcept
+{
+	static_assert(Length > 0u, "A string literal contains at least its null terminator.");
+
+	std::size_t length = findNullTerminator(literal, Length);
+
+	//Only a plain string literal is terminated by its last (and only) null character,
+	//anything else may be a buffer whose content changes, so copy it
+	return EntityName(literal, length, length == Length - 1u && !RFK_COPY_LITERAL_ENTITY_NAMES);
+}
+
+constexpr char const* EntityName::getData() const noexcept
+{
+	return _data;
+}
+
+constexpr std::size_t EntityName::getLength() const noexcept
+{
+	return _length;
+}
+
+constexpr bool EntityName::isStatic() const noexcept
+{
+	return _isStatic;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>	//std::is_lvalue_reference_v, std::remove_reference_t, std::remove_cv_t
+
+namespace rfk::internal
+{
+	/**
+	*	@brief	Get the argument to forward to a single call of a batched invocation.
+	*			Lvalue reference arguments are forwarded as is, while other arguments are copied
+	*			so that each call of the batch receives its own instance and the original argument is never moved from.
+	* 
+	*	@tparam ArgType Type of the parameter the argument is forwarded to.
+	* 
+	*	@param arg The argument provided to the batched invocation.
+	* 
+	*	@return arg itself if ArgType is an lvalue reference, else a copy of arg.
+	*/
+	template <typename ArgType>
+	decltype(auto) getBatchArgument(std::remove_reference_t<ArgType>& arg);
+
+	#include "Refureku/TypeInfo/Functions/BatchCallHelper.inl"
+}
\ No newline at end of file
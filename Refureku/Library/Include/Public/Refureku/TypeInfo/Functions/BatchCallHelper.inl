@@ -0,0 +1,19 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ArgType>
+decltype(auto) getBatchArgument(std::remove_reference_t<ArgType>& arg)
+{
+	if constexpr (std::is_lvalue_reference_v<ArgType>)
+	{
+		return arg;
+	}
+	else
+	{
+		return std::remove_cv_t<std::remove_reference_t<ArgType>>(arg);
+	}
+}
\ No newline at end of file
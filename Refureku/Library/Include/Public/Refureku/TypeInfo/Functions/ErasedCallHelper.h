@@ -0,0 +1,50 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <new>			//placement new
+#include <type_traits>	//std::is_void_v, std::is_reference_v, std::remove_reference_t
+#include <utility>		//std::forward, std::index_sequence
+
+namespace rfk::internal
+{
+	/** Base declaration of the helper. */
+	template <typename FunctionPrototype>
+	class ErasedCallHelper;
+
+	/**
+	*	Helper unpacking a type-erased arguments array and return slot (see ICallable::invokeErased)
+	*	to call a function with the signature ReturnType(ArgTypes...).
+	*/
+	template <typename ReturnType, typename... ArgTypes>
+	class ErasedCallHelper<ReturnType(ArgTypes...)>
+	{
+		private:
+			template <typename Functor, std::size_t... Indices>
+			static void invoke(Functor const&				functor,
+							   void* const*					args,
+							   void*						returnSlot,
+							   std::index_sequence<Indices...>);
+
+		public:
+			/**
+			*	@brief	Call the functor with the arguments pointed by args, and store the result in returnSlot.
+			* 
+			*	@param functor		Functor to call, with the signature ReturnType(ArgTypes&&...).
+			*	@param args			Array of sizeof...(ArgTypes) pointers, the i-th pointing to an object of the i-th argument type (reference removed).
+			*	@param returnSlot	Memory the result is written to, see ICallable::invokeErased. Can be nullptr to discard the result.
+			*/
+			template <typename Functor>
+			static void invoke(Functor const&	functor,
+							   void* const*		args,
+							   void*			returnSlot);
+	};
+
+	#include "Refureku/TypeInfo/Functions/ErasedCallHelper.inl"
+}
\ No newline at end of file
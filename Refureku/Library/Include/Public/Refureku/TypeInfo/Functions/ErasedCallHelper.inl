@@ -0,0 +1,43 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ReturnType, typename... ArgTypes>
+template <typename Functor>
+void ErasedCallHelper<ReturnType(ArgTypes...)>::invoke(Functor const& functor, void* const* args, void* returnSlot)
+{
+	invoke(functor, args, returnSlot, std::index_sequence_for<ArgTypes...>());
+}
+
+template <typename ReturnType, typename... ArgTypes>
+template <typename Functor, std::size_t... Indices>
+void ErasedCallHelper<ReturnType(ArgTypes...)>::invoke(Functor const& functor, [[maybe_unused]] void* const* args,
+													   [[maybe_unused]] void* returnSlot, std::index_sequence<Indices...>)
+{
+	if constexpr (std::is_void_v<ReturnType>)
+	{
+		functor(std::forward<ArgTypes>(*static_cast<std::remove_reference_t<ArgTypes>*>(args[Indices]))...);
+	}
+	else if constexpr (std::is_reference_v<ReturnType>)
+	{
+		//Return the address of the referenced object
+		ReturnType result = functor(std::forward<ArgTypes>(*static_cast<std::remove_reference_t<ArgTypes>*>(args[Indices]))...);
+
+		if (returnSlot != nullptr)
+		{
+			*static_cast<std::remove_reference_t<ReturnType>**>(returnSlot) = &result;
+		}
+	}
+	else if (returnSlot != nullptr)
+	{
+		//Construct the result directly in the return slot
+		new (returnSlot) ReturnType(functor(std::forward<ArgTypes>(*static_cast<std::remove_reference_t<ArgTypes>*>(args[Indices]))...));
+	}
+	else
+	{
+		functor(std::forward<ArgTypes>(*static_cast<std::remove_reference_t<ArgTypes>*>(args[Indices]))...);
+	}
+}
\ No newline at end of file
@@ -7,16 +7,19 @@
 
 #pragma once
 
+#include <cstddef>	//std::size_t
+
 #include "Refureku/TypeInfo/Functions/FunctionBase.h"
 #include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
 #include "Refureku/TypeInfo/Functions/NonMemberFunction.h"
+#include "Refureku/TypeInfo/Functions/BatchCallHelper.h"
 
 namespace rfk
 {
 	class Function final : public FunctionBase
 	{
 		public:
-			REFUREKU_API Function(char const*		name, 
+			REFUREKU_API Function(EntityName		name, 
 								  std::size_t		id,
 								  Type const&		returnType,
 								  ICallable*		internalFunction,
@@ -68,6 +71,50 @@ namespace rfk
 			template <typename ReturnType = void, typename... ArgTypes>
 			ReturnType									checkedInvoke(ArgTypes&&... args)	const;
 
+			/**
+			*	@brief	Call the function once per provided element, with the element as first argument followed by the same arguments, discarding the results.
+			*			The return type and arguments types are strictly checked once before the first call.
+			*			If there is any mismatch, ArgCountMismatch, ArgTypeMismatch or ReturnTypeMismatch will be thrown.
+			*			**WARNING 1**: Unreflected archetypes can't be compared, so they will pass through the type checks.
+			*			**WARNING 2**: Template type deduction might forward wrong types to the function
+			*			(int instead of int8_t or char* instead of std::string for example), so it is recommended
+			*			to explicitly specify all template types when calling the function.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam ElementType	Type of the elements, the first function parameter being an ElementType&.
+			*	@tparam... ArgTypes	Type of all remaining arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param elements			Array of non-null pointers to the elements each function call is performed on.
+			*	@param elementsCount	Number of pointers in the elements array.
+			*	@param args				Remaining arguments provided to each function call. Arguments which are not lvalue references are copied for each call.
+			* 
+			*	@exception	ArgCountMismatch if sizeof...(ArgTypes) + 1 is not the same as the value returned by getParametersCount().
+			*	@exception	ArgTypeMismatch if ElementType&, ArgTypes... are not strictly the same as this function parameter types.
+			*				**WARNING**: Be careful to template deduction.
+			*	@exception	ReturnTypeMismatch if ReturnType is not strictly the same as this function return type.
+			*	@exception	Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*/
+			template <typename ReturnType = void, typename ElementType, typename... ArgTypes>
+			void										invokeBatch(ElementType* const*	elements,
+																	std::size_t			elementsCount,
+																	ArgTypes&&...		args)	const;
+
+			/**
+			*	@brief	Call the function with type-erased arguments, so that the function signature doesn't need to be known at compile time.
+			*			Providing an args array or a returnSlot that doesn't match the function signature is undefined behaviour.
+			* 
+			*	@param args			Array of getParametersCount() pointers, the i-th pointing to an object of the i-th parameter type (reference removed).
+			*						Objects pointed for by-value and rvalue reference parameters are moved from.
+			*	@param returnSlot	If the function returns by value, uninitialized memory suitable for the return type the result is constructed in.
+			*						The caller is then responsible for destroying the result.
+			*						If the function returns a reference, pointer to a pointer receiving the address of the referenced object.
+			*						Can be nullptr to discard the result, and is ignored if the function returns void.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void							invokeErased(void* const*	args,
+																	 void*			returnSlot)	const;
+
 			/**
 			*	@brief Check whether this function is inline or not.
 			*
@@ -20,12 +20,22 @@ ReturnType Function::invoke(ArgTypes&&... args) const
 template <typename ReturnType, typename... ArgTypes>
 ReturnType Function::checkedInvoke(ArgTypes&&... args) const
 {
-	checkReturnType<ReturnType>();
-	checkParameterTypes<ArgTypes...>();
+	checkSignature<ReturnType, ArgTypes...>();
 
 	return invoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...);
 }
 
+template <typename ReturnType, typename ElementType, typename... ArgTypes>
+void Function::invokeBatch(ElementType* const* elements, std::size_t elementsCount, ArgTypes&&... args) const
+{
+	checkSignature<ReturnType, ElementType&, ArgTypes...>();
+
+	for (std::size_t i = 0u; i < elementsCount; i++)
+	{
+		internalInvoke<ReturnType, ElementType&, ArgTypes...>(*elements[i], internal::getBatchArgument<ArgTypes>(args)...);
+	}
+}
+
 template <auto FuncPtr>
 Function const* getFunction() noexcept
 {
@@ -10,6 +10,7 @@
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Functions/FunctionParameter.h"
 #include "Refureku/TypeInfo/Functions/ICallable.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 namespace rfk
 {
@@ -71,6 +72,14 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API std::size_t					getParametersCount()						const	noexcept;
 
+			/**
+			*	@brief	Get the fingerprint of this function signature, computed from the return type and the parameter types when they are registered.
+			*			Functions with the same signature have the same fingerprint.
+			* 
+			*	@return The fingerprint of this function signature.
+			*/
+			RFK_NODISCARD REFUREKU_API uint64						getSignatureFingerprint()					const	noexcept;
+
 			/**
 			*	@brief Get the internal function handled by this object.
 			*	
@@ -87,7 +96,7 @@ namespace rfk
 			*	
 			*	@return The added function parameter.
 			*/
-			REFUREKU_API FunctionParameter&							addParameter(char const*	name,
+			REFUREKU_API FunctionParameter&							addParameter(EntityName	name,
 																				 std::size_t	id,
 																				 Type const&	type)					noexcept;
 
@@ -135,7 +144,42 @@ namespace rfk
 			template <typename ReturnType>
 			void	checkReturnType()		const;
 
+			/**
+			*	@brief	Check that the provided return type and parameter types are the same as this function's.
+			*			In the common case where the types are strictly the same, this costs a single fingerprint comparison.
+			*	
+			*	@exception ReturnTypeMismatch if the provided return type is different from this function's return type.
+			*	@exception ArgCountMismatch if the argument count is different from this function arg count.
+			*	@exception ArgTypeMismatch if one the argument has a different type from the expected one.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			void	checkSignature()		const;
+
 		private:
+			/** Fingerprint of a function with no return type nor parameters. */
+			static constexpr uint64	_signatureFingerprintSeed = fnv1aOffsetBasis;
+
+			/**
+			*	@brief	Compute the fingerprint of a signature returning ReturnType and taking ArgTypes... parameters.
+			*			The fingerprint is computed once per template instantiation.
+			* 
+			*	@return The fingerprint of the signature.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD static uint64		computeSignatureFingerprint()							noexcept;
+
+			/**
+			*	@brief	Add a type to a signature fingerprint.
+			*			/!\ This method is called from template methods so it must be exported.
+			* 
+			*	@param fingerprint	Fingerprint of the signature so far.
+			*	@param type			Type to add to the fingerprint.
+			* 
+			*	@return The updated fingerprint.
+			*/
+			RFK_NODISCARD REFUREKU_API static uint64	combineSignatureFingerprint(uint64		fingerprint,
+																					Type const&	type)		noexcept;
+
 			/**
 			*	@brief Check that the provided type is the same as this function's.
 			* 
@@ -193,6 +237,9 @@ namespace rfk
 			*			/!\ This method is called from template methods so it must be exported.
 			*/
 			RFK_NORETURN REFUREKU_API void	throwReturnTypeMismatchException()						const;
+
+		//Structs memoize their instantiators by parameters fingerprint
+		friend class Struct;
 	};
 
 	#include "Refureku/TypeInfo/Functions/FunctionBase.inl"
@@ -107,4 +107,31 @@ void FunctionBase::checkReturnType() const
 	{
 		throwReturnTypeMismatchException();
 	}
+}
+
+template <typename ReturnType, typename... ArgTypes>
+uint64 FunctionBase::computeSignatureFingerprint() noexcept
+{
+	static uint64 const fingerprint = []
+	{
+		uint64 result = combineSignatureFingerprint(_signatureFingerprintSeed, rfk::getType<ReturnType>());
+
+		((result = combineSignatureFingerprint(result, rfk::getType<ArgTypes>())), ...);
+
+		return result;
+	}();
+
+	return fingerprint;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+void FunctionBase::checkSignature() const
+{
+	//Same fingerprint means strictly the same types: skip the type by type checks
+	if (computeSignatureFingerprint<ReturnType, ArgTypes...>() != getSignatureFingerprint())
+	{
+		//Either the signature is different, or the types only match (pointer - nullptr_t correspondance for example)
+		checkReturnType<ReturnType>();
+		checkParameterTypes<ArgTypes...>();
+	}
 }
\ No newline at end of file
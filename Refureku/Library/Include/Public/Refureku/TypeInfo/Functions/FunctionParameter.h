@@ -15,7 +15,7 @@ namespace rfk
 	class FunctionParameter final : public Entity
 	{
 		public:
-			REFUREKU_INTERNAL FunctionParameter(char const*		name,
+			REFUREKU_INTERNAL FunctionParameter(EntityName		name,
 												std::size_t		id,
 												Type const&		type,
 												Entity const*	outerEntity = nullptr)	noexcept;
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "Refureku/Misc/MetadataArena.h"
+
 namespace rfk
 {
 	class ICallable
@@ -15,6 +17,36 @@ namespace rfk
 			//Must be virtual because MemberFunction and NonMemberFunction instances are stored and deleted as SharedPtr<ICallable>
 			virtual	~ICallable() = default;
 
+			/**
+			*	@brief	Call the underlying function without knowing its signature at compile time.
+			*			The implementation is instantiated with the function signature, so calling it costs a single indirect call.
+			* 
+			*	@param caller		Instance the underlying function is called on. Ignored for non-member functions.
+			*	@param args			Array containing one pointer per function parameter, each pointing to an object of the parameter type (reference removed).
+			*						Objects pointed for by-value and rvalue reference parameters are moved from.
+			*	@param returnSlot	If the function returns by value, uninitialized memory suitable for the return type the result is constructed in.
+			*						The caller is then responsible for destroying the result.
+			*						If the function returns a reference, pointer to a pointer receiving the address of the referenced object.
+			*						Can be nullptr to discard the result, and is ignored if the function returns void.
+			*/
+			virtual void invokeErased(void*			caller,
+									  void* const*	args,
+									  void*			returnSlot)	const = 0;
+
+			/**
+			*	ICallable instances are created when the metadata is registered, so allocate them as metadata
+			*	to make them come from the current MetadataArena if any.
+			*/
+			static void* operator new(std::size_t size)
+			{
+				return internal::allocateMetadata(size);
+			}
+
+			static void operator delete(void* ptr) noexcept
+			{
+				internal::deallocateMetadata(ptr);
+			}
+
 		protected:
 			ICallable()					= default;
 			ICallable(ICallable const&)	= default;
@@ -11,6 +11,7 @@
 #include <cassert>
 
 #include "Refureku/TypeInfo/Functions/ICallable.h"
+#include "Refureku/TypeInfo/Functions/ErasedCallHelper.h"
 
 namespace rfk
 {
@@ -65,6 +66,17 @@ namespace rfk
 			*	@return The result forwarded from the method call.
 			*/
 			ReturnType operator()(CallerType const& caller, ArgTypes&&... args)	const;
+
+			/**
+			*	@brief Call the underlying function on the provided caller with type-erased arguments, see ICallable::invokeErased.
+			* 
+			*	@param caller		Pointer to the CallerType instance the underlying method is called on.
+			*	@param args			Pointers to the arguments.
+			*	@param returnSlot	Memory the result is written to.
+			*/
+			void invokeErased(void*			caller,
+							  void* const*	args,
+							  void*			returnSlot)						const	override;
 	};
 
 	#include "Refureku/TypeInfo/Functions/MemberFunction.inl"
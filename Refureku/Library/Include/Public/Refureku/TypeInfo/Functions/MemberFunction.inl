@@ -44,4 +44,13 @@ ReturnType MemberFunction<CallerType, ReturnType(ArgTypes...)>::operator()(Calle
 	assert(_isConst);
 
 	return (caller.*_constFunction)(std::forward<ArgTypes>(args)...);
+}
+
+template <typename CallerType, typename ReturnType, typename... ArgTypes>
+void MemberFunction<CallerType, ReturnType(ArgTypes...)>::invokeErased(void* caller, void* const* args, void* returnSlot) const
+{
+	internal::ErasedCallHelper<ReturnType(ArgTypes...)>::invoke([this, caller](ArgTypes&&... forwardedArgs) -> ReturnType
+																{
+																	return (*this)(*static_cast<CallerType*>(caller), std::forward<ArgTypes>(forwardedArgs)...);
+																}, args, returnSlot);
 }
\ No newline at end of file
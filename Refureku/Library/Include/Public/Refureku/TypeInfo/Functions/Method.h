@@ -8,6 +8,8 @@
 #pragma once
 
 #include <type_traits>	//std::enable_if_v, std::is_const_v
+#include <cstddef>		//std::size_t, std::ptrdiff_t
+#include <vector>
 #include <cassert>
 
 #include "Refureku/TypeInfo/Cast.h"
@@ -15,6 +17,7 @@
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Functions/MethodBase.h"
 #include "Refureku/TypeInfo/Functions/MemberFunction.h"
+#include "Refureku/TypeInfo/Functions/BatchCallHelper.h"
 #include "Refureku/Misc/CopyConstness.h"
 #include "Refureku/Exceptions/InvalidArchetype.h"
 
@@ -23,7 +26,7 @@ namespace rfk
 	class Method final : public MethodBase
 	{
 		public:
-			REFUREKU_INTERNAL Method(char const*		name,
+			REFUREKU_INTERNAL Method(EntityName		name,
 										std::size_t		id,
 										Type const&		returnType,
 										ICallable*		internalMethod,
@@ -203,6 +206,81 @@ namespace rfk
 			template <typename ReturnType = void, typename... ArgTypes>
 			ReturnType			checkedInvokeUnsafe(void const* caller, ArgTypes&&... args)	const;
 
+			/**
+			*	@brief	Call the method on each provided caller with the same arguments, discarding the results.
+			*			The return type and arguments types are strictly checked once before the first call.
+			*			If there is any mismatch, ArgCountMismatch, ArgTypeMismatch or ReturnTypeMismatch will be thrown.
+			*			If the method is virtual, the caller pointer adjustment is resolved once per distinct caller dynamic archetype,
+			*			so calling a method on many instances is much faster than calling Method::checkedInvoke in a loop.
+			*			**WARNING 1**: Unreflected archetypes can't be compared, so they will pass through the type checks.
+			*			**WARNING 2**: Template type deduction might forward wrong types to the function
+			*			(int instead of int8_t or char* instead of std::string for example), so it is recommended
+			*			to explicitly specify all template types when calling the function.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param callers		Array of non-null pointers to the instances calling the method.
+			*	@param callersCount	Number of pointers in the callers array.
+			*	@param args			Arguments provided to each method call. Arguments which are not lvalue references are copied for each call.
+			* 
+			*	@exception	ArgCountMismatch	if sizeof...(ArgTypes) is not the same as the value returned by getParametersCount().
+			*	@exception	ArgTypeMismatch		if ArgTypes... are not strictly the same as this function parameter types.
+			*				**WARNING**: Be careful to template deduction.
+			*	@exception	ReturnTypeMismatch	if ReturnType is not strictly the same as this function return type.
+			*	@exception	ConstViolation		if CallerType is const but the method is non-const.
+			*	@exception	InvalidArchetype	if a caller dynamic archetype couldn't be casted to the method outer struct's archetype.
+			*	@exception	Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			void				invokeBatch(CallerType* const*	callers,
+											std::size_t			callersCount,
+											ArgTypes&&...		args)									const;
+
+			/**
+			*	@brief	Call the method with type-erased arguments, so that the method signature doesn't need to be known at compile time.
+			*			Providing an args array or a returnSlot that doesn't match the method signature is undefined behaviour.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller so it has an undefined behaviour if caller
+			*			is not a valid pointer to an object of the method's owner archetype.
+			* 
+			*	@param caller		Object instance calling the method.
+			*	@param args			Array of getParametersCount() pointers, the i-th pointing to an object of the i-th parameter type (reference removed).
+			*						Objects pointed for by-value and rvalue reference parameters are moved from.
+			*	@param returnSlot	If the method returns by value, uninitialized memory suitable for the return type the result is constructed in.
+			*						The caller is then responsible for destroying the result.
+			*						If the method returns a reference, pointer to a pointer receiving the address of the referenced object.
+			*						Can be nullptr to discard the result, and is ignored if the method returns void.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void	invokeErased(void*			caller,
+											 void* const*	args,
+											 void*			returnSlot)									const;
+
+			/**
+			*	@brief	Call the method with type-erased arguments, so that the method signature doesn't need to be known at compile time.
+			*			Providing an args array or a returnSlot that doesn't match the method signature is undefined behaviour.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller so it has an undefined behaviour if caller
+			*			is not a valid pointer to an object of the method's owner archetype.
+			* 
+			*	@note This is only an overload of the same method with a const caller.
+			* 
+			*	@param caller		Object instance calling the method.
+			*	@param args			Array of getParametersCount() pointers, the i-th pointing to an object of the i-th parameter type (reference removed).
+			*						Objects pointed for by-value and rvalue reference parameters are moved from.
+			*	@param returnSlot	If the method returns by value, uninitialized memory suitable for the return type the result is constructed in.
+			*						The caller is then responsible for destroying the result.
+			*						If the method returns a reference, pointer to a pointer receiving the address of the referenced object.
+			*						Can be nullptr to discard the result, and is ignored if the method returns void.
+			* 
+			*	@exception ConstViolation if the method is non-const.
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void	invokeErased(void const*	caller,
+											 void* const*	args,
+											 void*			returnSlot)									const;
+
 			/**
 			*	@brief	Inherit from the properties this method overrides.
 			*			If the method is not an override, this method does nothing.
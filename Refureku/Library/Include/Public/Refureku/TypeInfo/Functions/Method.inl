@@ -100,8 +100,7 @@ ReturnType Method::checkedInvoke(CallerType& caller, ArgTypes&&... args) const
 template <typename ReturnType, typename... ArgTypes>
 ReturnType Method::checkedInvokeUnsafe(void* caller, ArgTypes&&... args) const
 {
-	checkReturnType<ReturnType>();
-	checkParameterTypes<ArgTypes...>();
+	checkSignature<ReturnType, ArgTypes...>();
 
 	return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...);
 }
@@ -114,12 +113,81 @@ ReturnType Method::checkedInvokeUnsafe(void const* caller, ArgTypes&&... args) c
 		throwConstViolationException();
 	}
 
-	checkReturnType<ReturnType>();
-	checkParameterTypes<ArgTypes...>();
+	checkSignature<ReturnType, ArgTypes...>();
 
 	return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...);
 }
 
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+void Method::invokeBatch(CallerType* const* callers, std::size_t callersCount, ArgTypes&&... args) const
+{
+	using AdjustedCallerType = typename CopyConstness<CallerType, void>::Type;
+	using CallerBytesType = typename CopyConstness<CallerType, char>::Type;
+
+	if constexpr (std::is_const_v<CallerType>)
+	{
+		if (!isConst())
+		{
+			throwConstViolationException();
+		}
+	}
+
+	checkSignature<ReturnType, ArgTypes...>();
+
+	//Non-virtual methods can be called with non-adjusted instances (doesn't use virtual table)
+	if (!isVirtual())
+	{
+		for (std::size_t i = 0u; i < callersCount; i++)
+		{
+			internalInvoke<ReturnType, ArgTypes...>(static_cast<AdjustedCallerType*>(callers[i]), internal::getBatchArgument<ArgTypes>(args)...);
+		}
+
+		return;
+	}
+
+	Struct const&	callerStaticArchetype	= CallerType::staticGetArchetype();
+	Struct const&	outerStruct				= *static_cast<Struct const*>(getOuterEntity());
+
+	//Pointer offsets already resolved in this batch, by caller dynamic archetype
+	std::vector<internal::DynamicCastCacheEntry>	resolvedOffsets;
+	std::size_t										lastResolvedOffsetIndex = 0u;
+
+	for (std::size_t i = 0u; i < callersCount; i++)
+	{
+		CallerType*		caller					= callers[i];
+		Struct const&	callerDynamicArchetype	= caller->getArchetype();
+
+		if (resolvedOffsets.empty() || resolvedOffsets[lastResolvedOffsetIndex].dynamicArchetype != &callerDynamicArchetype)
+		{
+			lastResolvedOffsetIndex = 0u;
+
+			while (lastResolvedOffsetIndex < resolvedOffsets.size() && resolvedOffsets[lastResolvedOffsetIndex].dynamicArchetype != &callerDynamicArchetype)
+			{
+				lastResolvedOffsetIndex++;
+			}
+
+			if (lastResolvedOffsetIndex == resolvedOffsets.size())
+			{
+				CallerType* adjustedCallerPointer = rfk::dynamicCast<CallerType>(caller, callerStaticArchetype, callerDynamicArchetype, outerStruct);
+
+				if (adjustedCallerPointer == nullptr)
+				{
+					throw InvalidArchetype("Failed to adjust the caller pointer since it has no relationship with the method's outer struct.");
+				}
+
+				internal::DynamicCastCacheEntry& entry = resolvedOffsets.emplace_back();
+
+				entry.dynamicArchetype	= &callerDynamicArchetype;
+				entry.pointerOffset		= reinterpret_cast<CallerBytesType*>(adjustedCallerPointer) - reinterpret_cast<CallerBytesType*>(caller);
+				entry.isSuccessful		= true;
+			}
+		}
+
+		internalInvoke<ReturnType, ArgTypes...>(static_cast<AdjustedCallerType*>(reinterpret_cast<CallerBytesType*>(caller) + resolvedOffsets[lastResolvedOffsetIndex].pointerOffset),
+												internal::getBatchArgument<ArgTypes>(args)...);
+	}
+}
+
 template <typename CallerType>
 CallerType* Method::adjustCallerPointerAddress(CallerType* caller) const
 {
@@ -10,6 +10,7 @@
 #include <utility>	//std::forward
 
 #include "Refureku/TypeInfo/Functions/ICallable.h"
+#include "Refureku/TypeInfo/Functions/ErasedCallHelper.h"
 
 namespace rfk
 {
@@ -46,6 +47,17 @@ namespace rfk
 			*	@return The result of the underlying call.
 			*/
 			ReturnType operator()(ArgTypes&&... args)	const;
+
+			/**
+			*	@brief Call the underlying function with type-erased arguments, see ICallable::invokeErased.
+			* 
+			*	@param caller		Ignored.
+			*	@param args			Pointers to the arguments.
+			*	@param returnSlot	Memory the result is written to.
+			*/
+			void invokeErased(void*			caller,
+							  void* const*	args,
+							  void*			returnSlot)	const	override;
 	};
 
 	#include "Refureku/TypeInfo/Functions/NonMemberFunction.inl"
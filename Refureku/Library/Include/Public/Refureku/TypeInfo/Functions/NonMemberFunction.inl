@@ -28,4 +28,10 @@ template <typename ReturnType, typename... ArgTypes>
 ReturnType NonMemberFunction<ReturnType(ArgTypes...)>::operator()(ArgTypes&&... args) const
 {
 	return _function(std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+void NonMemberFunction<ReturnType(ArgTypes...)>::invokeErased(void* /* caller */, void* const* args, void* returnSlot) const
+{
+	internal::ErasedCallHelper<ReturnType(ArgTypes...)>::invoke(_function, args, returnSlot);
 }
\ No newline at end of file
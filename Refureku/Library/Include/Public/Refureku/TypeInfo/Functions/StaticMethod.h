@@ -15,7 +15,7 @@ namespace rfk
 	class StaticMethod final : public MethodBase
 	{
 		public:
-			REFUREKU_API	  StaticMethod(char const*		name,
+			REFUREKU_API	  StaticMethod(EntityName		name,
 										   std::size_t		id,
 										   Type const&		returnType,
 										   ICallable*		internalMethod,
@@ -68,6 +68,22 @@ namespace rfk
 			template <typename ReturnType = void, typename... ArgTypes>
 			ReturnType	checkedInvoke(ArgTypes&&... args)	const;
 
+			/**
+			*	@brief	Call the static method with type-erased arguments, so that the static method signature doesn't need to be known at compile time.
+			*			Providing an args array or a returnSlot that doesn't match the static method signature is undefined behaviour.
+			* 
+			*	@param args			Array of getParametersCount() pointers, the i-th pointing to an object of the i-th parameter type (reference removed).
+			*						Objects pointed for by-value and rvalue reference parameters are moved from.
+			*	@param returnSlot	If the static method returns by value, uninitialized memory suitable for the return type the result is constructed in.
+			*						The caller is then responsible for destroying the result.
+			*						If the static method returns a reference, pointer to a pointer receiving the address of the referenced object.
+			*						Can be nullptr to discard the result, and is ignored if the static method returns void.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void	invokeErased(void* const*	args,
+											 void*			returnSlot)	const;
+
 		private:
 			//Forward declaration
 			class StaticMethodImpl;
@@ -20,8 +20,7 @@ ReturnType StaticMethod::invoke(ArgTypes&&... args) const
 template <typename ReturnType, typename... ArgTypes>
 ReturnType StaticMethod::checkedInvoke(ArgTypes&&... args) const
 {
-	checkReturnType<ReturnType>();
-	checkParameterTypes<ArgTypes...>();
+	checkSignature<ReturnType, ArgTypes...>();
 
 	return invoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...);
 }
\ No newline at end of file
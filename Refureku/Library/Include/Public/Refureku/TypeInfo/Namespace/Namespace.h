@@ -21,11 +21,12 @@ namespace rfk
 	class Variable;
 	class Function;
 	class Archetype;
+	class Database;
 
 	class Namespace final : public Entity
 	{
 		public:
-			REFUREKU_INTERNAL Namespace(char const*	name,
+			REFUREKU_INTERNAL Namespace(EntityName	name,
 										std::size_t	id)		noexcept;
 			Namespace(Namespace&&)							= delete;
 			REFUREKU_INTERNAL ~Namespace()					noexcept;
@@ -458,6 +459,8 @@ namespace rfk
 			class NamespaceImpl;
 
 			RFK_GEN_GET_PIMPL(NamespaceImpl, Entity::getPimpl())
+
+		friend Database;
 	};
 
 	REFUREKU_TEMPLATE_API(rfk::Allocator<Namespace const*>);
@@ -17,13 +17,14 @@ namespace rfk
 	class NamespaceFragment final : public Entity
 	{
 		public:
-			REFUREKU_API NamespaceFragment(char const*	name,
+			REFUREKU_API NamespaceFragment(EntityName	name,
 										   std::size_t	id = 0u)	noexcept;
 			NamespaceFragment(NamespaceFragment&&)					= delete;
 			REFUREKU_API ~NamespaceFragment()						noexcept;
 
 			/**
-			*	@brief Add a nested entity to the namespace.
+			*	@brief	Add a nested entity to the namespace fragment.
+			*			The nested entity is added to the merged namespace when the fragment is registered to the database.
 			*	
 			*	@param nestedEntity The nested entity to add to the namespace fragment.
 			*	
@@ -42,7 +43,8 @@ namespace rfk
 
 			/**
 			*	@brief	Add a property to this namespace fragment.
-			*			The property is immediately added to the merged namespace.
+			*			Properties added before the fragment is registered to the database are added to the merged namespace
+			*			when the fragment is registered. Properties added afterwards are immediately added to the merged namespace.
 			*	
 			*	@param property The property to add.
 			*	
@@ -52,7 +54,9 @@ namespace rfk
 			REFUREKU_API bool						addProperty(Property const& property)					noexcept;
 
 			/**
-			*	@brief Get the namespace this fragment is merged to.
+			*	@brief	Get the namespace this fragment is merged to.
+			*			/!\ The fragment is merged when it is registered to the database (see NamespaceFragmentRegisterer),
+			*			so this method must not be called before.
 			* 
 			*	@return The namespace this fragment is merged to.
 			*/
@@ -72,6 +76,12 @@ namespace rfk
 			REFUREKU_INTERNAL bool					foreachNestedEntity(Visitor<Entity>	visitor,
 																		void*			userData)	const;
 
+			/**
+			*	@brief	Merge the fragment (and its nested fragments) to the namespace of the same id, creating it if necessary.
+			*			The caller must own the database write lock.
+			*/
+			REFUREKU_INTERNAL void					mergeFragment()									const	noexcept;
+
 			/**
 			*	@brief Unmerge the fragment from the merged namespace.
 			*/
@@ -10,7 +10,7 @@
 #include <cstddef>		//std::size_t
 #include <type_traits>	//std::is_const_v, std::is_volatile_v, std::is_array_v, ...
 
-#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/Misc/InitializationGuard.h"
 #include "Refureku/TypeInfo/TypePart.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 
@@ -19,10 +19,10 @@ namespace rfk
 	class Type
 	{
 		public:
-			REFUREKU_API Type()		noexcept;
-			Type(Type const&)		noexcept;
-			Type(Type&&)			noexcept;
-			REFUREKU_API ~Type()	noexcept;
+			REFUREKU_API Type()					noexcept;
+			REFUREKU_API Type(Type const&)		noexcept;
+			REFUREKU_API Type(Type&&)			noexcept;
+			REFUREKU_API ~Type()				noexcept;
 
 			/**
 			*	@brief	Get the type part at the specified index.
@@ -124,21 +124,46 @@ namespace rfk
 			REFUREKU_API void					optimizeMemory()							noexcept;
 
 
+			/**
+			*	@brief	Check whether two types are strictly the same.
+			*			Types retrieved from rfk::getType are canonical: two different canonical types are never equal,
+			*			so comparing them is a pointer comparison.
+			*/
 			REFUREKU_API bool operator==(Type const&)	const	noexcept;
 			REFUREKU_API bool operator!=(Type const&)	const	noexcept;
 
-		protected:
-			//Forward declaration
-			class TypeImpl;
+			REFUREKU_API Type& operator=(Type const&)	noexcept;
+			REFUREKU_API Type& operator=(Type&&)		noexcept;
 
 		private:
-			/** Concrete implementation of the Type class. */
-			Pimpl<TypeImpl> _pimpl;
+			/** Number of type parts stored in the type itself, enough for most types (T, T*, T const&, T const*&...). */
+			static constexpr uint32	_inlinePartsCapacity = 3u;
+
+			/** Parts of this type, if it has no more than _inlinePartsCapacity parts. */
+			TypePart			_inlineParts[_inlinePartsCapacity];
+
+			/** Dynamically allocated parts of this type, used instead of _inlineParts if the type has more than _inlinePartsCapacity parts. */
+			TypePart*			_spilledParts			= nullptr;
+
+			/** Number of parts of this type. */
+			uint32				_partsCount				= 0u;
+
+			/** Number of parts _spilledParts can contain. */
+			uint32				_spilledPartsCapacity	= 0u;
+
+			/** Archetype of this type. */
+			Archetype const*	_archetype				= nullptr;
+
+			/** Is this type the canonical instance registered in the type interning table. Copies of a canonical type are never canonical. */
+			bool				_isCanonical			= false;
 
 			//The rfk::getType<T> method can access Type internal methods to fill the type
 			template <typename T>
 			friend Type const& getType() noexcept;
 
+			//Template arguments hash their type to index class template instantiations
+			friend class TemplateArgument;
+
 			/**
 			*	@brief Fill the provided Type according to template type T.
 			* 
@@ -146,11 +171,45 @@ namespace rfk
 			*/
 			template <typename T>
 			static void	fillType(Type& out_type)	noexcept;
+
+			/**
+			*	@brief	Get the canonical instance of the provided type from the library-wide type interning table.
+			*			If the type is not in the table yet, a canonical copy of the type is added to the table.
+			*			/!\ This method is called from template methods so it must be exported.
+			* 
+			*	@param type The fully filled type to intern.
+			* 
+			*	@return The canonical instance of the provided type. It stays valid as long as the library is loaded.
+			*/
+			RFK_NODISCARD REFUREKU_API static Type const&	getCanonicalType(Type const& type)	noexcept;
+
+			/**
+			*	@brief Get the parts of this type, wherever they are stored.
+			* 
+			*	@return A pointer to the first part of this type.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL TypePart*		getParts()							noexcept;
+			RFK_NODISCARD REFUREKU_INTERNAL TypePart const*	getParts()					const	noexcept;
+
+			/**
+			*	@brief Copy the parts and archetype of another type into this type.
+			* 
+			*	@param other The type to copy.
+			*/
+			REFUREKU_INTERNAL void							copyFrom(Type const& other)			noexcept;
+
+			/**
+			*	@brief Compute a hash of the archetype and parts of this type.
+			* 
+			*	@return The computed hash. Equal types have the same hash.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL std::size_t		computeHash()				const	noexcept;
 	};
 
 	/**
 	*	@brief	Retrieve the Type object from a given type.
-	*			Identical types will return the same Type object (the returned object will have the same address in memory).
+	*			Identical types will return the same canonical Type object (the returned object will have the same address in memory),
+	*			even across modules.
 	* 
 	*	@return The computed type.
 	*/
@@ -55,16 +55,21 @@ void Type::fillType(Type& out_type) noexcept
 template <typename T>
 Type const& getType() noexcept
 {
-	static Type	result;
-	static bool	initialized = false;
+	static internal::InitializationGuard	initGuard;
+	static Type								result;
 
-	if (!initialized)
-	{
-		initialized = true;
+	//Recursive requests issued while result is being filled get the (partially filled) local result
+	static Type const*						canonicalResult = &result;
 
+	if (initGuard.tryBeginInitialization())
+	{
 		Type::fillType<T>(result);
 		result.optimizeMemory();
+
+		canonicalResult = &Type::getCanonicalType(result);
+
+		initGuard.endInitialization();
 	}
 
-	return result;
+	return *canonicalResult;
 }
\ No newline at end of file
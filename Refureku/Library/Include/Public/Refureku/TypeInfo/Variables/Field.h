@@ -17,7 +17,7 @@ namespace rfk
 	class Field final : public FieldBase
 	{
 		public:
-			REFUREKU_INTERNAL Field(char const*		name,
+			REFUREKU_INTERNAL Field(EntityName		name,
 									std::size_t		id,
 									Type const&		type,
 									EFieldFlags		flags,
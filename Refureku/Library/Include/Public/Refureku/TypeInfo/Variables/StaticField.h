@@ -18,14 +18,14 @@ namespace rfk
 	class StaticField final : public FieldBase
 	{
 		public:
-			REFUREKU_INTERNAL StaticField(char const*	name,
+			REFUREKU_INTERNAL StaticField(EntityName	name,
 										  std::size_t	id,
 										  Type const&	type,
 										  EFieldFlags	flags,
 										  Struct const*	owner,
 										  void*			ptr,
 										  Entity const*	outerEntity = nullptr)	noexcept;
-			REFUREKU_INTERNAL StaticField(char const*	name,
+			REFUREKU_INTERNAL StaticField(EntityName	name,
 										  std::size_t	id,
 										  Type const&	type,
 										  EFieldFlags	flags,
@@ -15,12 +15,12 @@ namespace rfk
 	class Variable final : public VariableBase
 	{
 		public:
-			REFUREKU_API		Variable(char const*	name,
+			REFUREKU_API		Variable(EntityName	name,
 										 std::size_t	id,
 										 Type const&	type,
 										 void*			ptr,
 										 EVarFlags		flags)		noexcept;
-			REFUREKU_API		Variable(char const*	name,
+			REFUREKU_API		Variable(EntityName	name,
 										 std::size_t	id,
 										 Type const&	type,
 										 void const*	constPtr,
@@ -0,0 +1,61 @@
+#include "Refureku/Misc/InitializationGuard.h"
+
+#include <mutex>
+#include <cstddef>	//std::size_t
+#include <cassert>
+
+using namespace rfk::internal;
+
+/**
+*	@brief Get the mutex used to serialize all metadata initializations.
+*
+*	@return The library metadata initialization mutex.
+*/
+static std::recursive_mutex& getInitializationMutex() noexcept
+{
+	static std::recursive_mutex mutex;
+
+	return mutex;
+}
+
+/** Number of initializations in progress on the calling thread. */
+static thread_local std::size_t threadInitializationDepth = 0u;
+
+bool InitializationGuard::tryBeginInitializationSlow() noexcept
+{
+	getInitializationMutex().lock();
+
+	//Only this thread can change the state from here since the initialization mutex is locked.
+	switch (_state.load(std::memory_order_relaxed))
+	{
+		case EState::Uninitialized:
+			//The mutex is released in endInitialization
+			_state.store(EState::Initializing, std::memory_order_relaxed);
+			threadInitializationDepth++;
+			return true;
+
+		case EState::Initializing:
+			//The initializing thread owns the mutex, so this is a recursive request from the initializing thread itself.
+			[[fallthrough]];
+		case EState::Initialized:
+			[[fallthrough]];
+		default:
+			getInitializationMutex().unlock();
+			return false;
+	}
+}
+
+void InitializationGuard::endInitialization() noexcept
+{
+	assert(_state.load(std::memory_order_relaxed) == EState::Initializing);
+
+	_state.store(EState::Initialized, std::memory_order_release);
+	threadInitializationDepth--;
+
+	getInitializationMutex().unlock();
+}
+
+bool InitializationGuard::isInitializingOnCallingThread() noexcept
+{
+	return threadInitializationDepth != 0u;
+}
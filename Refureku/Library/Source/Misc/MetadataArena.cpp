@@ -0,0 +1,326 @@
+#include "Refureku/Misc/MetadataArena.h"
+
+#include <new>		//::operator new, ::operator delete, std::bad_alloc
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <map>
+#include <vector>
+#include <cstdint>		//std::uintptr_t
+#include <algorithm>	//std::max
+
+using namespace rfk;
+
+namespace rfk::internal
+{
+	class MetadataArenaImpl;
+
+	/**
+	*	Address ranges of the blocks of all alive arenas, used to find the arena some metadata was allocated from.
+	*	Metadata allocated from the global heap has no header, so this is the only way to tell both apart on deallocation.
+	*/
+	class MetadataArenaBlocks
+	{
+		private:
+			struct Block
+			{
+				/** Address past the end of the block. */
+				std::uintptr_t		end;
+
+				/** Arena owning the block. */
+				MetadataArenaImpl*	arena;
+			};
+
+			/** Mutex protecting _blocksByAddress. */
+			std::shared_mutex						_mutex;
+
+			/** Blocks of all alive arenas, indexed by their start address. */
+			std::map<std::uintptr_t, Block>			_blocksByAddress;
+
+			/** Number of blocks in _blocksByAddress, so that deallocations can skip the lookup when no arena is used. */
+			inline static std::atomic<std::size_t>	_blocksCount = 0u;
+
+			MetadataArenaBlocks() = default;
+
+		public:
+			/**
+			*	@brief	Get the blocks registry.
+			*			It is never destroyed since metadata can be deallocated during static destruction.
+			* 
+			*	@return The blocks registry.
+			*/
+			static MetadataArenaBlocks& getInstance() noexcept
+			{
+				static MetadataArenaBlocks* instance = new MetadataArenaBlocks();
+
+				return *instance;
+			}
+
+			/**
+			*	@brief Check whether some arena blocks are alive.
+			* 
+			*	@return true if no arena block is alive, in which case all metadata comes from the global heap.
+			*/
+			static bool isEmpty() noexcept
+			{
+				return _blocksCount.load(std::memory_order_acquire) == 0u;
+			}
+
+			void add(void* block, std::size_t size, MetadataArenaImpl* arena)
+			{
+				std::unique_lock lock(_mutex);
+
+				std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(block);
+
+				_blocksByAddress.emplace(begin, Block{ begin + size, arena });
+				_blocksCount.fetch_add(1u, std::memory_order_release);
+			}
+
+			void remove(void* block) noexcept
+			{
+				std::unique_lock lock(_mutex);
+
+				_blocksByAddress.erase(reinterpret_cast<std::uintptr_t>(block));
+				_blocksCount.fetch_sub(1u, std::memory_order_release);
+			}
+
+			/**
+			*	@brief Find the arena the provided memory was allocated from.
+			* 
+			*	@param ptr The memory to look for.
+			* 
+			*	@return The arena owning ptr if any, else nullptr.
+			*/
+			MetadataArenaImpl* find(void const* ptr) noexcept
+			{
+				std::shared_lock lock(_mutex);
+
+				std::uintptr_t	address	= reinterpret_cast<std::uintptr_t>(ptr);
+				auto			it		= _blocksByAddress.upper_bound(address);
+
+				if (it == _blocksByAddress.cbegin())
+				{
+					return nullptr;
+				}
+
+				--it;
+
+				return (address < it->second.end) ? it->second.arena : nullptr;
+			}
+	};
+
+	class MetadataArenaImpl
+	{
+		private:
+			/** Mutex protecting the arena state, since metadata can be allocated and deallocated from any thread. */
+			std::mutex			_mutex;
+
+			/** Blocks allocated from the global heap. */
+			std::vector<void*>	_blocks;
+
+			/** Size of a block. Allocations bigger than a block get their own block. */
+			std::size_t			_blockSize;
+
+			/** Next free byte in the last block. */
+			unsigned char*		_current			= nullptr;
+
+			/** Number of free bytes after _current. */
+			std::size_t			_remaining			= 0u;
+
+			/** Total number of bytes allocated from the global heap. */
+			std::size_t			_reservedBytes		= 0u;
+
+			/** Number of allocations which have not been deallocated yet. */
+			std::size_t			_aliveAllocations	= 0u;
+
+			/** Is the owning MetadataArena destroyed? */
+			bool				_released			= false;
+
+			~MetadataArenaImpl() noexcept
+			{
+				MetadataArenaBlocks& blocksRegistry = MetadataArenaBlocks::getInstance();
+
+				for (void* block : _blocks)
+				{
+					blocksRegistry.remove(block);
+					::operator delete(block);
+				}
+			}
+
+		public:
+			explicit MetadataArenaImpl(std::size_t blockSize) noexcept:
+				_blockSize{blockSize}
+			{
+			}
+
+			/**
+			*	@brief Bump-allocate memory from the arena.
+			* 
+			*	@param size Number of bytes to allocate, multiple of alignof(std::max_align_t).
+			* 
+			*	@return The allocated memory.
+			*/
+			void* allocate(std::size_t size)
+			{
+				std::lock_guard lock(_mutex);
+
+				if (size > _remaining)
+				{
+					std::size_t blockSize = std::max(size, _blockSize);
+
+					_blocks.reserve(_blocks.size() + 1u);
+
+					void* block = ::operator new(blockSize);
+
+					try
+					{
+						MetadataArenaBlocks::getInstance().add(block, blockSize, this);
+					}
+					catch (...)
+					{
+						::operator delete(block);
+						throw;
+					}
+
+					_current		= static_cast<unsigned char*>(block);
+					_remaining		= blockSize;
+					_reservedBytes	+= blockSize;
+					_blocks.push_back(_current);
+				}
+
+				void* result = _current;
+
+				_current	+= size;
+				_remaining	-= size;
+				_aliveAllocations++;
+
+				return result;
+			}
+
+			/**
+			*	@brief Notify the arena that an allocation has been deallocated. The memory is only reclaimed when the arena is released.
+			*/
+			void deallocate() noexcept
+			{
+				bool shouldDelete;
+
+				{
+					std::lock_guard lock(_mutex);
+
+					shouldDelete = (--_aliveAllocations == 0u) && _released;
+				}
+
+				if (shouldDelete)
+				{
+					delete this;
+				}
+			}
+
+			/**
+			*	@brief Release the arena, which is deleted as soon as no allocation is alive anymore.
+			*/
+			void release() noexcept
+			{
+				bool shouldDelete;
+
+				{
+					std::lock_guard lock(_mutex);
+
+					_released		= true;
+					shouldDelete	= (_aliveAllocations == 0u);
+				}
+
+				if (shouldDelete)
+				{
+					delete this;
+				}
+			}
+
+			std::size_t getAliveAllocationsCount() noexcept
+			{
+				std::lock_guard lock(_mutex);
+
+				return _aliveAllocations;
+			}
+
+			std::size_t getReservedBytes() noexcept
+			{
+				std::lock_guard lock(_mutex);
+
+				return _reservedBytes;
+			}
+	};
+}
+
+using namespace rfk::internal;
+
+/** Alignment of the arena allocations, so that the next arena allocation stays aligned. */
+static constexpr std::size_t metadataAlignment = alignof(std::max_align_t);
+
+/** Arena used by the current thread to allocate metadata, nullptr if metadata is allocated from the global heap. */
+static thread_local MetadataArenaImpl* currentArena = nullptr;
+
+MetadataArena::MetadataArena(std::size_t blockSize) noexcept:
+	_impl{new MetadataArenaImpl(blockSize)}
+{
+}
+
+MetadataArena::~MetadataArena() noexcept
+{
+	_impl->release();
+}
+
+std::size_t MetadataArena::getAliveAllocationsCount() const noexcept
+{
+	return _impl->getAliveAllocationsCount();
+}
+
+std::size_t MetadataArena::getReservedBytes() const noexcept
+{
+	return _impl->getReservedBytes();
+}
+
+MetadataArenaScope::MetadataArenaScope(MetadataArena& arena) noexcept:
+	_previousArena{currentArena}
+{
+	currentArena = arena._impl;
+}
+
+MetadataArenaScope::~MetadataArenaScope() noexcept
+{
+	currentArena = _previousArena;
+}
+
+void* rfk::internal::allocateMetadata(std::size_t size)
+{
+	MetadataArenaImpl* arena = currentArena;
+
+	//Without arena, metadata is a plain heap allocation: no header nor size rounding
+	if (arena == nullptr)
+	{
+		return ::operator new(size);
+	}
+
+	//Round the size up so that the next arena allocation stays aligned
+	return arena->allocate((std::max<std::size_t>(size, 1u) + metadataAlignment - 1u) / metadataAlignment * metadataAlignment);
+}
+
+void rfk::internal::deallocateMetadata(void* ptr) noexcept
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	//Skip the arena lookup when no arena block is alive, since the memory must come from the global heap
+	MetadataArenaImpl* arena = MetadataArenaBlocks::isEmpty() ? nullptr : MetadataArenaBlocks::getInstance().find(ptr);
+
+	if (arena != nullptr)
+	{
+		arena->deallocate();
+	}
+	else
+	{
+		::operator delete(ptr);
+	}
+}
@@ -1,7 +1,5 @@
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 
-#include <cstring> //std::strcmp
-
 #include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
 #include "Refureku/Misc/Algorithm.h"
 
@@ -10,16 +8,16 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Enum const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Enum const*, rfk::Allocator<Enum const*>>;
 
-Enum::Enum(char const* name, std::size_t id, Archetype const* underlyingArchetype, Entity const* outerEntity) noexcept:
+Enum::Enum(EntityName name, std::size_t id, Archetype const* underlyingArchetype, Entity const* outerEntity) noexcept:
 	Archetype(new EnumImpl(name, id, underlyingArchetype, outerEntity))
 {
 }
 
 Enum::~Enum() noexcept = default;
 
-EnumValue* Enum::addEnumValue(char const* name, std::size_t id, int64 value) noexcept
+EnumValue* Enum::addEnumValue(EntityName name, std::size_t id, int64 value) noexcept
 {
-	return (name != nullptr) ? &getPimpl()->addEnumValue(name, id, value, this) : nullptr;
+	return (name.getData() != nullptr) ? &getPimpl()->addEnumValue(name, id, value, this) : nullptr;
 }
 
 void Enum::setEnumValuesCapacity(std::size_t capacity) noexcept
@@ -29,18 +27,17 @@ void Enum::setEnumValuesCapacity(std::size_t capacity) noexcept
 
 EnumValue const* Enum::getEnumValueByName(char const* name) const noexcept
 {
-	return (name != nullptr) ? Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [name](EnumValue const& ev)
-											   {
-												   return std::strcmp(ev.getName(), name) == 0;
-											   }) : nullptr;
+	return (name != nullptr) ? getPimpl()->getEnumValueByName(name) : nullptr;
+}
+
+EnumValue const* Enum::getEnumValueByName(std::string_view name) const noexcept
+{
+	return getPimpl()->getEnumValueByName(name);
 }
 
 EnumValue const* Enum::getEnumValue(int64 value) const noexcept
 {
-	return Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-											   {
-												   return ev.getValue() == value;
-											   });
+	return getPimpl()->getEnumValue(value);
 }
 
 EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, void* userData) const
@@ -50,10 +47,16 @@ EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, v
 
 Vector<EnumValue const*> Enum::getEnumValues(int64 value) const noexcept
 {
-	return Algorithm::getItemsByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-												 {
-													 return ev.getValue() == value;
-												 });
+	auto [first, last] = getPimpl()->getEnumValues(value);
+
+	Vector<EnumValue const*> result(last - first);
+
+	for (; first != last; first++)
+	{
+		result.push_back(*first);
+	}
+
+	return result;
 }
 
 Vector<EnumValue const*> Enum::getEnumValuesByPredicate(Predicate<EnumValue> predicate, void* userData) const
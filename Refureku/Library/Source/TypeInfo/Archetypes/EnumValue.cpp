@@ -7,7 +7,7 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<EnumValue const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<EnumValue const*, rfk::Allocator<EnumValue const*>>;
 
-EnumValue::EnumValue(char const* name, std::size_t id, int64 value, Entity const* outerEntity) noexcept:
+EnumValue::EnumValue(EntityName name, std::size_t id, int64 value, Entity const* outerEntity) noexcept:
 	Entity(new EnumValueImpl(name, id, value, outerEntity))
 {
 }
@@ -4,7 +4,7 @@
 
 using namespace rfk;
 
-FundamentalArchetype::FundamentalArchetype(char const* name, std::size_t id, std::size_t memorySize) noexcept:
+FundamentalArchetype::FundamentalArchetype(EntityName name, std::size_t id, std::size_t memorySize) noexcept:
 	Archetype(new FundamentalArchetypeImpl(name, id, memorySize))
 {
 }
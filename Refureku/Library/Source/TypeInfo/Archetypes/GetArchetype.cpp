@@ -1,17 +1,17 @@
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 
 #include <cstddef>
-#include <string_view>	//std::hash<std::string_view>
 
 #include "Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 using namespace rfk;
 
 template <>
 Archetype const* rfk::getArchetype<void>() noexcept
 {
-	static FundamentalArchetype archetype("void", std::hash<std::string_view>()("void"), 0u);
+	static FundamentalArchetype archetype(EntityName::fromLiteral("void"), computeEntityIdHash("void"), 0u);
 
 	return &archetype;
 }
@@ -21,7 +21,7 @@ ArchetypeRegisterer voidRegisterer = *rfk::getArchetype<void>();
 template <>
 Archetype const* rfk::getArchetype<std::nullptr_t>() noexcept
 {
-	static FundamentalArchetype archetype("nullptr_t", std::hash<std::string_view>()("nullptr_t"), sizeof(std::nullptr_t));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("nullptr_t"), computeEntityIdHash("nullptr_t"), sizeof(std::nullptr_t));
 
 	return &archetype;
 }
@@ -31,7 +31,7 @@ ArchetypeRegisterer nullptrRegisterer = *rfk::getArchetype<std::nullptr_t>();
 template <>
 Archetype const* rfk::getArchetype<bool>() noexcept
 {
-	static FundamentalArchetype archetype("bool", std::hash<std::string_view>()("bool"), sizeof(bool));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("bool"), computeEntityIdHash("bool"), sizeof(bool));
 
 	return &archetype;
 }
@@ -41,7 +41,7 @@ ArchetypeRegisterer boolRegisterer = *rfk::getArchetype<bool>();
 template <>
 Archetype const* rfk::getArchetype<char>() noexcept
 {
-	static FundamentalArchetype archetype("char", std::hash<std::string_view>()("char"), sizeof(char));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("char"), computeEntityIdHash("char"), sizeof(char));
 
 	return &archetype;
 }
@@ -51,7 +51,7 @@ ArchetypeRegisterer charRegisterer = *rfk::getArchetype<char>();
 template <>
 Archetype const* rfk::getArchetype<signed char>() noexcept
 {
-	static FundamentalArchetype archetype("signed char", std::hash<std::string_view>()("signed char"), sizeof(signed char));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("signed char"), computeEntityIdHash("signed char"), sizeof(signed char));
 
 	return &archetype;
 }
@@ -61,7 +61,7 @@ ArchetypeRegisterer signedCharRegisterer = *rfk::getArchetype<signed char>();
 template <>
 Archetype const* rfk::getArchetype<unsigned char>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned char", std::hash<std::string_view>()("unsigned char"), sizeof(unsigned char));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("unsigned char"), computeEntityIdHash("unsigned char"), sizeof(unsigned char));
 
 	return &archetype;
 }
@@ -71,7 +71,7 @@ ArchetypeRegisterer ucharRegisterer = *rfk::getArchetype<unsigned char>();
 template <>
 Archetype const* rfk::getArchetype<wchar_t>() noexcept
 {
-	static FundamentalArchetype archetype("wchar", std::hash<std::string_view>()("wchar"), sizeof(wchar_t));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("wchar"), computeEntityIdHash("wchar"), sizeof(wchar_t));
 
 	return &archetype;
 }
@@ -81,7 +81,7 @@ ArchetypeRegisterer wcharRegisterer = *rfk::getArchetype<wchar_t>();
 template <>
 Archetype const* rfk::getArchetype<char16_t>() noexcept
 {
-	static FundamentalArchetype archetype("char16", std::hash<std::string_view>()("char16"), sizeof(char16_t));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("char16"), computeEntityIdHash("char16"), sizeof(char16_t));
 
 	return &archetype;
 }
@@ -91,7 +91,7 @@ ArchetypeRegisterer char16Registerer = *rfk::getArchetype<char16_t>();
 template <>
 Archetype const* rfk::getArchetype<char32_t>() noexcept
 {
-	static FundamentalArchetype archetype("char32", std::hash<std::string_view>()("char32"), sizeof(char32_t));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("char32"), computeEntityIdHash("char32"), sizeof(char32_t));
 
 	return &archetype;
 }
@@ -101,7 +101,7 @@ ArchetypeRegisterer char32Registerer = *rfk::getArchetype<char32_t>();
 template <>
 Archetype const* rfk::getArchetype<short>() noexcept
 {
-	static FundamentalArchetype archetype("short", std::hash<std::string_view>()("short"), sizeof(short));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("short"), computeEntityIdHash("short"), sizeof(short));
 
 	return &archetype;
 }
@@ -111,7 +111,7 @@ ArchetypeRegisterer shortRegisterer = *rfk::getArchetype<short>();
 template <>
 Archetype const* rfk::getArchetype<unsigned short>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned short", std::hash<std::string_view>()("unsigned short"), sizeof(unsigned short));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("unsigned short"), computeEntityIdHash("unsigned short"), sizeof(unsigned short));
 
 	return &archetype;
 }
@@ -121,7 +121,7 @@ ArchetypeRegisterer ushortRegisterer = *rfk::getArchetype<unsigned short>();
 template <>
 Archetype const* rfk::getArchetype<int>() noexcept
 {
-	static FundamentalArchetype archetype("int", std::hash<std::string_view>()("int"), sizeof(int));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("int"), computeEntityIdHash("int"), sizeof(int));
 
 	return &archetype;
 }
@@ -131,7 +131,7 @@ ArchetypeRegisterer intRegisterer = *rfk::getArchetype<int>();
 template <>
 Archetype const* rfk::getArchetype<unsigned int>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned int", std::hash<std::string_view>()("unsigned int"), sizeof(unsigned int));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("unsigned int"), computeEntityIdHash("unsigned int"), sizeof(unsigned int));
 
 	return &archetype;
 }
@@ -141,7 +141,7 @@ ArchetypeRegisterer uintRegisterer = *rfk::getArchetype<unsigned int>();
 template <>
 Archetype const* rfk::getArchetype<long>() noexcept
 {
-	static FundamentalArchetype archetype("long", std::hash<std::string_view>()("long"), sizeof(long));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("long"), computeEntityIdHash("long"), sizeof(long));
 
 	return &archetype;
 }
@@ -151,7 +151,7 @@ ArchetypeRegisterer longRegisterer = *rfk::getArchetype<long>();
 template <>
 Archetype const* rfk::getArchetype<unsigned long>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned long", std::hash<std::string_view>()("unsigned long"), sizeof(unsigned long));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("unsigned long"), computeEntityIdHash("unsigned long"), sizeof(unsigned long));
 
 	return &archetype;
 }
@@ -161,7 +161,7 @@ ArchetypeRegisterer ulongRegisterer = *rfk::getArchetype<unsigned long>();
 template <>
 Archetype const* rfk::getArchetype<long long>() noexcept
 {
-	static FundamentalArchetype archetype("long long", std::hash<std::string_view>()("long long"), sizeof(long long));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("long long"), computeEntityIdHash("long long"), sizeof(long long));
 
 	return &archetype;
 }
@@ -171,7 +171,7 @@ ArchetypeRegisterer longLongRegisterer = *rfk::getArchetype<long long>();
 template <>
 Archetype const* rfk::getArchetype<unsigned long long>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned long long", std::hash<std::string_view>()("unsigned long long"), sizeof(unsigned long long));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("unsigned long long"), computeEntityIdHash("unsigned long long"), sizeof(unsigned long long));
 
 	return &archetype;
 }
@@ -181,7 +181,7 @@ ArchetypeRegisterer ulongLongRegisterer = *rfk::getArchetype<unsigned long long>
 template <>
 Archetype const* rfk::getArchetype<float>() noexcept
 {
-	static FundamentalArchetype archetype("float", std::hash<std::string_view>()("float"), sizeof(float));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("float"), computeEntityIdHash("float"), sizeof(float));
 
 	return &archetype;
 }
@@ -191,7 +191,7 @@ ArchetypeRegisterer floatRegisterer = *rfk::getArchetype<float>();
 template <>
 Archetype const* rfk::getArchetype<double>() noexcept
 {
-	static FundamentalArchetype archetype("double", std::hash<std::string_view>()("double"), sizeof(double));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("double"), computeEntityIdHash("double"), sizeof(double));
 
 	return &archetype;
 }
@@ -201,7 +201,7 @@ ArchetypeRegisterer doubleRegisterer = *rfk::getArchetype<double>();
 template <>
 Archetype const* rfk::getArchetype<long double>() noexcept
 {
-	static FundamentalArchetype archetype("long double", std::hash<std::string_view>()("long double"), sizeof(long double));
+	static FundamentalArchetype archetype(EntityName::fromLiteral("long double"), computeEntityIdHash("long double"), sizeof(long double));
 
 	return &archetype;
 }
@@ -9,12 +9,12 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Struct const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Struct const*, rfk::Allocator<Struct const*>>;
 
-Struct::Struct(char const* name, std::size_t id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
+Struct::Struct(EntityName name, std::size_t id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
 	Archetype(new StructImpl(name, id, memorySize, isClass, classKind))
 {
 }
 
-Struct::Struct(char const* name, std::size_t id, std::size_t memorySize, bool isClass) noexcept:
+Struct::Struct(EntityName name, std::size_t id, std::size_t memorySize, bool isClass) noexcept:
 	Struct(name, id, memorySize, isClass, EClassKind::Standard)
 {
 }
@@ -90,9 +90,12 @@ bool Struct::isSubclassOf(Struct const& archetype) const noexcept
 
 bool Struct::isBaseOf(Struct const& archetype) const noexcept
 {
-	auto const& subclasses = getPimpl()->getSubclasses();
+	return getPimpl()->isBaseOf(*this, archetype);
+}
 
-	return &archetype == this || subclasses.find(&archetype) != subclasses.cend();
+bool Struct::hasZeroPointerOffsetParents() const noexcept
+{
+	return getPimpl()->hasZeroPointerOffsetAncestors(*this);
 }
 
 EClassKind Struct::getClassKind() const noexcept
@@ -266,7 +269,7 @@ Field const* Struct::getFieldByName(char const* name, EFieldFlags minFlags, bool
 {
 	Field const* result = nullptr;
 
-	Algorithm::foreachEntityNamed(getPimpl()->getFields(),
+	Algorithm::foreachEntityNamed(getPimpl()->getFieldsByName(),
 									  name,
 									  [this, &result, minFlags, shouldInspectInherited](Field const& field)
 									  {
@@ -358,7 +361,7 @@ StaticField const* Struct::getStaticFieldByName(char const* name, EFieldFlags mi
 {
 	StaticField const* result = nullptr;
 
-	Algorithm::foreachEntityNamed(getPimpl()->getStaticFields(),
+	Algorithm::foreachEntityNamed(getPimpl()->getStaticFieldsByName(),
 									  name,
 									  [this, &result, minFlags, shouldInspectInherited](StaticField const& staticField)
 									  {
@@ -426,42 +429,29 @@ Method const* Struct::getMethodByName(char const* name, EMethodFlags minFlags, b
 {
 	Method const* result = nullptr;
 
-	bool foundMethod = !Algorithm::foreachEntityNamed(getPimpl()->getMethods(),
-									  name,
-									  [&result, minFlags](Method const& method)
-									  {
-										  if ((method.getFlags() & minFlags) == minFlags)
-										  {
-											  //We found a method that satisfies minFlags
-											  result = &method;
-											  return false;
-										  }
+	auto visitor = [&result, minFlags](Method const& method)
+	{
+		if ((method.getFlags() & minFlags) == minFlags)
+		{
+			//We found a method that satisfies minFlags
+			result = &method;
+			return false;
+		}
 
-										  return true;
-									  });
+		return true;
+	};
 
-	if (foundMethod)
+	//The inherited methods table contains this struct methods first, then parent methods, so a single probe is enough
+	if (shouldInspectInherited)
 	{
-		return result;
+		Algorithm::foreachEntityNamed(getPimpl()->getInheritedMethods(), name, visitor);
 	}
 	else
 	{
-		//If we reach this point, couldn't find a valid method
-		if (shouldInspectInherited)
-		{
-			for (ParentStruct const& parent : getPimpl()->getDirectParents())
-			{
-				result = parent.getArchetype().getMethodByName(name, minFlags, true);
-
-				if (result != nullptr)
-				{
-					return result;
-				}
-			}
-		}
-
-		return nullptr;
+		Algorithm::foreachEntityNamed(getPimpl()->getMethodsByName(), name, visitor);
 	}
+
+	return result;
 }
 
 Vector<Method const*> Struct::getMethodsByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
@@ -469,25 +459,24 @@ Vector<Method const*> Struct::getMethodsByName(char const* name, EMethodFlags mi
 	//Users using this method likely are waiting for at least 2 results, so default capacity to 2.
 	Vector<Method const*> result(2);
 
-	Algorithm::foreachEntityNamed(getPimpl()->getMethods(),
-									 name,
-									 [&result, minFlags](Method const& method)
-									 {
-										 if ((method.getFlags() & minFlags) == minFlags)
-										 {
-											 //We found a method that satisfies minFlags
-											 result.push_back(&method);
-										 }
+	auto visitor = [&result, minFlags](Method const& method)
+	{
+		if ((method.getFlags() & minFlags) == minFlags)
+		{
+			//We found a method that satisfies minFlags
+			result.push_back(&method);
+		}
 
-										 return true;
-									 });
+		return true;
+	};
 
 	if (shouldInspectInherited)
 	{
-		for (ParentStruct const& parent : getPimpl()->getDirectParents())
-		{
-			result.push_back(parent.getArchetype().getMethodsByName(name, minFlags, true));
-		}
+		Algorithm::foreachEntityNamed(getPimpl()->getInheritedMethods(), name, visitor);
+	}
+	else
+	{
+		Algorithm::foreachEntityNamed(getPimpl()->getMethodsByName(), name, visitor);
 	}
 
 	return result;
@@ -573,42 +562,29 @@ StaticMethod const* Struct::getStaticMethodByName(char const* name, EMethodFlags
 {
 	StaticMethod const*	result = nullptr;
 
-	bool foundMethod = !Algorithm::foreachEntityNamed(getPimpl()->getStaticMethods(),
-														 name,
-														 [&result, minFlags](StaticMethod const& staticMethod)
-														 {
-															 if ((staticMethod.getFlags() & minFlags) == minFlags)
-															 {
-																 //We found a static method that satisfies minFlags
-																 result = &staticMethod;
-																 return false;
-															 }
+	auto visitor = [&result, minFlags](StaticMethod const& staticMethod)
+	{
+		if ((staticMethod.getFlags() & minFlags) == minFlags)
+		{
+			//We found a static method that satisfies minFlags
+			result = &staticMethod;
+			return false;
+		}
 
-															 return true;
-														 });
+		return true;
+	};
 
-	if (foundMethod)
+	//The inherited static methods table contains this struct static methods first, then parent static methods, so a single probe is enough
+	if (shouldInspectInherited)
 	{
-		return result;
+		Algorithm::foreachEntityNamed(getPimpl()->getInheritedStaticMethods(), name, visitor);
 	}
 	else
 	{
-		//If we reach this point, couldn't find a valid static method
-		if (shouldInspectInherited)
-		{
-			for (ParentStruct const& parent : getPimpl()->getDirectParents())
-			{
-				result = parent.getArchetype().getStaticMethodByName(name, minFlags, true);
-
-				if (result != nullptr)
-				{
-					return result;
-				}
-			}
-		}
-
-		return nullptr;
+		Algorithm::foreachEntityNamed(getPimpl()->getStaticMethodsByName(), name, visitor);
 	}
+
+	return result;
 }
 
 Vector<StaticMethod const*> Struct::getStaticMethodsByName(char const* name, EMethodFlags minFlags, bool shouldInspectInherited) const noexcept
@@ -616,26 +592,24 @@ Vector<StaticMethod const*> Struct::getStaticMethodsByName(char const* name, EMe
 	//Users using this method likely are waiting for at least 2 results, so default capacity to 2.
 	Vector<StaticMethod const*>	result(2);
 
-	Algorithm::foreachEntityNamed(getPimpl()->getStaticMethods(),
-								   	 name,
-								   	 [&result, minFlags](StaticMethod const& staticMethod)
-								   	 {
-								   		 if ((staticMethod.getFlags() & minFlags) == minFlags)
-								   		 {
-								   			 //We found a static method that satisfies minFlags
-								   			 result.push_back(&staticMethod);
-								   		 }
-								   
-								   		 return true;
-								   	 });
-
-	//If we reach this point, couldn't find a valid method
-	if (shouldInspectInherited)
+	auto visitor = [&result, minFlags](StaticMethod const& staticMethod)
 	{
-		for (ParentStruct const& parent : getPimpl()->getDirectParents())
+		if ((staticMethod.getFlags() & minFlags) == minFlags)
 		{
-			result.push_back(parent.getArchetype().getStaticMethodsByName(name, minFlags, true));
+			//We found a static method that satisfies minFlags
+			result.push_back(&staticMethod);
 		}
+
+		return true;
+	};
+
+	if (shouldInspectInherited)
+	{
+		Algorithm::foreachEntityNamed(getPimpl()->getInheritedStaticMethods(), name, visitor);
+	}
+	else
+	{
+		Algorithm::foreachEntityNamed(getPimpl()->getStaticMethodsByName(), name, visitor);
 	}
 
 	return result;
@@ -750,10 +724,10 @@ void Struct::setNestedArchetypesCapacity(std::size_t capacity) noexcept
 	getPimpl()->setNestedArchetypesCapacity(capacity);
 }
 
-Field* Struct::addField(char const* name, std::size_t id, Type const& type,
+Field* Struct::addField(EntityName name, std::size_t id, Type const& type,
 							  EFieldFlags flags, std::size_t memoryOffset, Struct const* outerEntity) noexcept
 {
-	return (name != nullptr) ? getPimpl()->addField(name, id, type, flags, this, memoryOffset, outerEntity) : nullptr;
+	return (name.getData() != nullptr) ? getPimpl()->addField(name, id, type, flags, this, memoryOffset, outerEntity) : nullptr;
 }
 
 void Struct::setFieldsCapacity(std::size_t capacity) noexcept
@@ -761,16 +735,16 @@ void Struct::setFieldsCapacity(std::size_t capacity) noexcept
 	return getPimpl()->setFieldsCapacity(capacity);
 }
 
-StaticField* Struct::addStaticField(char const* name, std::size_t id, Type const& type,
+StaticField* Struct::addStaticField(EntityName name, std::size_t id, Type const& type,
 									EFieldFlags flags, void* fieldPtr, Struct const* outerEntity) noexcept
 {
-	return (name != nullptr) ? getPimpl()->addStaticField(name, id, type, flags, this, fieldPtr, outerEntity) : nullptr;
+	return (name.getData() != nullptr) ? getPimpl()->addStaticField(name, id, type, flags, this, fieldPtr, outerEntity) : nullptr;
 }
 
-StaticField* Struct::addStaticField(char const* name, std::size_t id, Type const& type,
+StaticField* Struct::addStaticField(EntityName name, std::size_t id, Type const& type,
 									EFieldFlags flags, void const* fieldPtr, Struct const* outerEntity) noexcept
 {
-	return (name != nullptr) ? getPimpl()->addStaticField(name, id, type, flags, this, fieldPtr, outerEntity) : nullptr;
+	return (name.getData() != nullptr) ? getPimpl()->addStaticField(name, id, type, flags, this, fieldPtr, outerEntity) : nullptr;
 }
 
 void Struct::setStaticFieldsCapacity(std::size_t capacity) noexcept
@@ -778,10 +752,10 @@ void Struct::setStaticFieldsCapacity(std::size_t capacity) noexcept
 	return getPimpl()->setStaticFieldsCapacity(capacity);
 }
 
-Method* Struct::addMethod(char const* name, std::size_t id, Type const& returnType,
+Method* Struct::addMethod(EntityName name, std::size_t id, Type const& returnType,
 						  ICallable* internalMethod, EMethodFlags flags) noexcept
 {
-	return (name != nullptr) ? getPimpl()->addMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
+	return (name.getData() != nullptr) ? getPimpl()->addMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
 }
 
 void Struct::setMethodsCapacity(std::size_t capacity) noexcept
@@ -789,10 +763,10 @@ void Struct::setMethodsCapacity(std::size_t capacity) noexcept
 	return getPimpl()->setMethodsCapacity(capacity);
 }
 
-StaticMethod* Struct::addStaticMethod(char const* name, std::size_t id, Type const& returnType,
+StaticMethod* Struct::addStaticMethod(EntityName name, std::size_t id, Type const& returnType,
 									  ICallable* internalMethod, EMethodFlags flags) noexcept
 {
-	return (name != nullptr) ? getPimpl()->addStaticMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
+	return (name.getData() != nullptr) ? getPimpl()->addStaticMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
 }
 
 void Struct::setStaticMethodsCapacity(std::size_t capacity) noexcept
@@ -863,6 +837,16 @@ bool Struct::foreachUniqueInstantiator(std::size_t argCount, Visitor<StaticMetho
 	return result;
 }
 
+bool Struct::getMemoizedInstantiators(uint64 parametersFingerprint, StaticMethod const*& out_sharedInstantiator, StaticMethod const*& out_uniqueInstantiator, uint64& out_generation) const noexcept
+{
+	return getPimpl()->getResolvedInstantiators(parametersFingerprint, out_sharedInstantiator, out_uniqueInstantiator, out_generation);
+}
+
+void Struct::memoizeInstantiators(uint64 parametersFingerprint, StaticMethod const* sharedInstantiator, StaticMethod const* uniqueInstantiator, uint64 generation) const noexcept
+{
+	getPimpl()->addResolvedInstantiators(parametersFingerprint, sharedInstantiator, uniqueInstantiator, generation);
+}
+
 void Struct::addSharedInstantiator(StaticMethod const& instantiator) noexcept
 {
 	getPimpl()->addSharedInstantiator(instantiator);
@@ -6,7 +6,7 @@
 
 using namespace rfk;
 
-ClassTemplate::ClassTemplate(char const* name, std::size_t id, bool isClass) noexcept:
+ClassTemplate::ClassTemplate(EntityName name, std::size_t id, bool isClass) noexcept:
 	Struct(new ClassTemplateImpl(name, id, isClass))
 {
 }
@@ -30,26 +30,7 @@ std::size_t ClassTemplate::getTemplateInstantiationsCount() const noexcept
 
 ClassTemplateInstantiation const* ClassTemplate::getTemplateInstantiation(TemplateArgument const** firstArg, std::size_t argsCount) const noexcept
 {
-	if (firstArg != nullptr)
-	{
-		for (ClassTemplateInstantiation const* instantiation : getPimpl()->getTemplateInstantiations())
-		{
-			for (std::size_t i = 0u; i < argsCount; i++)
-			{
-				if (*(firstArg + i) != nullptr && instantiation->getTemplateArgumentAt(i) != **(firstArg + i))
-				{
-					break;
-				}
-				else if (i == argsCount - 1)
-				{
-					//If we reach this point, last 2 template arguments are equal
-					return instantiation;
-				}
-			}
-		}
-	}
-	
-	return nullptr;
+	return getPimpl()->getTemplateInstantiation(firstArg, argsCount);
 }
 
 bool ClassTemplate::foreachTemplateInstantiation(Visitor<ClassTemplateInstantiation> visitor, void* userData) const
@@ -1,11 +1,12 @@
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiation.h"
 
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiationImpl.h"
+#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.h"
 #include "Refureku/Misc/Algorithm.h"
 
 using namespace rfk;
 
-ClassTemplateInstantiation::ClassTemplateInstantiation(char const* name, std::size_t id, std::size_t memorySize, bool isClass, Archetype const& classTemplate) noexcept:
+ClassTemplateInstantiation::ClassTemplateInstantiation(EntityName name, std::size_t id, std::size_t memorySize, bool isClass, Archetype const& classTemplate) noexcept:
 	Struct(new ClassTemplateInstantiationImpl(name, id, memorySize, isClass, classTemplate))
 {
 	//A getArchetype specialization should be generated for each template specialization, so instantiatedFrom should contain a ClassTemplate
@@ -43,4 +44,7 @@ std::size_t ClassTemplateInstantiation::getTemplateArgumentsCount() const noexce
 void ClassTemplateInstantiation::addTemplateArgument(TemplateArgument const& argument) noexcept
 {
 	getPimpl()->addTemplateArgument(argument);
+
+	//The class template indexes its instantiations by template arguments
+	const_cast<ClassTemplate&>(getPimpl()->getClassTemplate()).getPimpl()->indexLastTemplateArgument(*this);
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "Refureku/TypeInfo/Archetypes/Template/TypeTemplateArgument.h"
 #include "Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Archetype.h"
+#include "Refureku/TypeInfo/Type.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 using namespace rfk;
 
@@ -42,4 +45,42 @@ bool TemplateArgument::operator==(TemplateArgument const& other) const noexcept
 bool TemplateArgument::operator!=(TemplateArgument const& other) const noexcept
 {
 	return !(*this == other);
+}
+
+std::size_t TemplateArgument::computeHash() const noexcept
+{
+	uint64 result = combineHash(fnv1aOffsetBasis, static_cast<uint64>(_pimpl->getKind()));
+
+	switch (_pimpl->getKind())
+	{
+		case ETemplateParameterKind::TypeTemplateParameter:
+			result = combineHash(result, static_cast<TypeTemplateArgument const&>(*this).getType().computeHash());
+			break;
+
+		case ETemplateParameterKind::NonTypeTemplateParameter:
+		{
+			NonTypeTemplateArgument const&	nonTypeArgument	= static_cast<NonTypeTemplateArgument const&>(*this);
+			Archetype const*				valueArchetype	= nonTypeArgument.getArchetype();
+
+			result = combineHashBytes(result, &valueArchetype, sizeof(valueArchetype));
+
+			//Non-type arguments are compared bytewise, so their value bytes can be hashed directly
+			if (valueArchetype != nullptr)
+			{
+				result = combineHashBytes(result, nonTypeArgument.getValuePtr(), valueArchetype->getMemorySize());
+			}
+
+			break;
+		}
+
+		case ETemplateParameterKind::TemplateTemplateParameter:
+		{
+			ClassTemplate const* classTemplate = static_cast<TemplateTemplateArgument const&>(*this).getClassTemplate();
+
+			result = combineHashBytes(result, &classTemplate, sizeof(classTemplate));
+			break;
+		}
+	}
+
+	return static_cast<std::size_t>(result);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "Refureku/TypeInfo/Cast.h"
 
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/DatabaseImpl.h"
 
 using namespace rfk;
 
@@ -13,7 +14,17 @@ void* internal::dynamicCast(void* instance, Struct const& instanceStaticArchetyp
 void const* internal::dynamicCast(void const* instance, Struct const& instanceStaticArchetype,
 						Struct const& instanceDynamicArchetype, Struct const& targetArchetype) noexcept
 {
-	//TODO: Optimization if the concrete type has a single branch inheritance tree: don't perform this intermediate computation
+	if (instance == nullptr)
+	{
+		return nullptr;
+	}
+
+	//If all reflected parents of the concrete type are located at offset 0, the instance pointer is the same for all the types
+	//of the hierarchy, so there is no pointer to adjust: only check that both static and target archetypes belong to the hierarchy
+	if (instanceDynamicArchetype.hasZeroPointerOffsetParents())
+	{
+		return (instanceStaticArchetype.isBaseOf(instanceDynamicArchetype) && targetArchetype.isBaseOf(instanceDynamicArchetype)) ? instance : nullptr;
+	}
 
 	void const* adjustedStaticToDynamicInstancePointer = internal::dynamicDownCast(instance, instanceStaticArchetype, instanceDynamicArchetype);
 
@@ -36,6 +47,12 @@ void const* internal::dynamicUpCast(void const* instance, Struct const& instance
 		return instance;
 	}
 
+	//No pointer offset to compute if all parents of the instance are located at offset 0
+	if (instanceStaticArchetype.hasZeroPointerOffsetParents())
+	{
+		return targetArchetype.isBaseOf(instanceStaticArchetype) ? instance : nullptr;
+	}
+
 	std::ptrdiff_t pointerOffset;
 
 	//Get the memory offset
@@ -61,6 +78,12 @@ void const* internal::dynamicDownCast(void const* instance, Struct const& instan
 		return instance;
 	}
 
+	//No pointer offset to compute if all parents of the target are located at offset 0
+	if (targetArchetype.hasZeroPointerOffsetParents())
+	{
+		return instanceStaticArchetype.isBaseOf(targetArchetype) ? instance : nullptr;
+	}
+
 	std::ptrdiff_t pointerOffset;
 
 	//Get the memory offset
@@ -71,4 +94,9 @@ void const* internal::dynamicDownCast(void const* instance, Struct const& instan
 	}
 
 	return nullptr;
+}
+
+uint64 internal::getDatabaseRegistrationGeneration() noexcept
+{
+	return Database::DatabaseImpl::getRegistrationGeneration();
 }
\ No newline at end of file
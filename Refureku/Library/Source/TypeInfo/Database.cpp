@@ -1,8 +1,9 @@
 #include "Refureku/TypeInfo/Database.h"
 
-#include <string>
-
 #include "Refureku/TypeInfo/DatabaseImpl.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceImpl.h"
+#include "Refureku/TypeInfo/Archetypes/StructImpl.h"
+#include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
 #include "Refureku/Misc/Algorithm.h"
 #include "Refureku/TypeInfo/Entity/EntityCast.h"
 #include "Refureku/Exceptions/BadNamespaceFormat.h"
@@ -16,6 +17,16 @@ Database::Database() noexcept:
 
 Database::~Database() noexcept = default;
 
+void Database::beginRegistrationBatch() noexcept
+{
+	getInstance()._pimpl->lockWrite();
+}
+
+void Database::endRegistrationBatch() noexcept
+{
+	getInstance()._pimpl->unlockWrite();
+}
+
 Database& Database::getInstance() noexcept
 {
 	static Database database;
@@ -25,27 +36,125 @@ Database& Database::getInstance() noexcept
 
 Entity const* Database::getEntityById(std::size_t id) const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityPtrById(_pimpl->getEntitiesById(), id);
 }
 
+Vector<Entity const*> Database::getEntitiesWithProperty(Struct const& archetype, bool isChildClassValid) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
+	Vector<Entity const*>				result;
+	DatabaseImpl::EntitiesSet const*	entities = _pimpl->getEntitiesWithProperty(archetype, isChildClassValid);
+
+	if (entities != nullptr)
+	{
+		result.reserve(entities->size());
+
+		for (Entity const* entity : *entities)
+		{
+			result.push_back(entity);
+		}
+	}
+
+	return result;
+}
+
 Namespace const* Database::getNamespaceById(std::size_t id) const noexcept
 {
 	return namespaceCast(getEntityById(id));
 }
 
+Entity const* Database::getEntityByQualifiedName(std::string_view qualifiedName) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
+	std::size_t		separatorIndex	= qualifiedName.find("::");
+	std::string_view	name			= qualifiedName.substr(0u, separatorIndex);
+	Entity const*	result			= nullptr;
+
+	//Search the first name part in the file level entities
+	if ((result = Algorithm::getEntityByName(_pimpl->getFileLevelNamespacesByName(), name)) == nullptr &&
+		(result = Algorithm::getEntityByName(_pimpl->getFileLevelClassesByName(), name)) == nullptr &&
+		(result = Algorithm::getEntityByName(_pimpl->getFileLevelStructsByName(), name)) == nullptr &&
+		(result = Algorithm::getEntityByName(_pimpl->getFileLevelEnumsByName(), name)) == nullptr &&
+		(result = Algorithm::getEntityByName(_pimpl->getFileLevelVariablesByName(), name)) == nullptr &&
+		(result = Algorithm::getEntityByName(_pimpl->getFileLevelFunctionsByName(), name)) == nullptr)
+	{
+		result = Algorithm::getEntityByName(_pimpl->getFundamentalArchetypesByName(), name);
+	}
+
+	while (separatorIndex != std::string_view::npos && result != nullptr)
+	{
+		//Remove the previous name part and the :: separator
+		qualifiedName	= qualifiedName.substr(separatorIndex + 2u);
+		separatorIndex	= qualifiedName.find("::");
+		name			= qualifiedName.substr(0u, separatorIndex);
+
+		switch (result->getKind())
+		{
+			case EEntityKind::Namespace:
+			{
+				Namespace::NamespaceImpl const* namespaceImpl = static_cast<Namespace const*>(result)->getPimpl();
+
+				if ((result = Algorithm::getEntityByName(namespaceImpl->getNamespaces(), name)) == nullptr &&
+					(result = Algorithm::getEntityByName(namespaceImpl->getArchetypes(), name)) == nullptr &&
+					(result = Algorithm::getEntityByName(namespaceImpl->getVariables(), name)) == nullptr)
+				{
+					result = Algorithm::getEntityByName(namespaceImpl->getFunctions(), name);
+				}
+				break;
+			}
+
+			case EEntityKind::Struct:
+				[[fallthrough]];
+			case EEntityKind::Class:
+			{
+				Struct::StructImpl const* structImpl = static_cast<Struct const*>(result)->getPimpl();
+
+				if ((result = Algorithm::getEntityByName(structImpl->getNestedArchetypes(), name)) == nullptr &&
+					(result = Algorithm::getEntityByName(structImpl->getFieldsByName(), name)) == nullptr &&
+					(result = Algorithm::getEntityByName(structImpl->getStaticFieldsByName(), name)) == nullptr &&
+					(result = Algorithm::getEntityByName(structImpl->getMethodsByName(), name)) == nullptr)
+				{
+					result = Algorithm::getEntityByName(structImpl->getStaticMethodsByName(), name);
+				}
+				break;
+			}
+
+			case EEntityKind::Enum:
+				result = static_cast<Enum const*>(result)->getPimpl()->getEnumValueByName(name);
+				break;
+
+			default:
+				//Other entities don't contain named entities
+				result = nullptr;
+				break;
+		}
+	}
+
+	return result;
+}
+
 Namespace const* Database::getNamespaceByName(char const* name) const
 {
-	std::string namespaceName(name);
+	return (name != nullptr) ? getNamespaceByName(std::string_view(name)) : nullptr;
+}
+
+Namespace const* Database::getNamespaceByName(std::string_view name) const
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
 
-	std::size_t index = namespaceName.find_first_of(':');
+	std::size_t index = name.find_first_of(':');
 
-	//Make sure namespaceName has a valid namespace syntax
-	if (index != std::string::npos && (index == 0 || index == namespaceName.size() - 1 || namespaceName[index + 1] != ':'))
+	//Make sure name has a valid namespace syntax
+	if (index != std::string_view::npos && (index == 0 || index == name.size() - 1 || name[index + 1] != ':'))
 	{
 		throw BadNamespaceFormat("The provided namespace name is ill formed.");
 	}
 
-	Namespace const* result = Algorithm::getEntityByName(_pimpl->getFileLevelNamespacesByName(), namespaceName.substr(0u, index).data());
+	Namespace const* result = Algorithm::getEntityByName(_pimpl->getFileLevelNamespacesByName(), name.substr(0u, index));
 
 	//Couldn't find first namespace part, abort search
 	if (result == nullptr)
@@ -53,19 +162,19 @@ Namespace const* Database::getNamespaceByName(char const* name) const
 		return nullptr;
 	}
 
-	while (index != std::string::npos && result != nullptr)
+	while (index != std::string_view::npos && result != nullptr)
 	{
-		if (namespaceName.size() <= index + 2u ||	//The provided namespace name either ends with : or :[some char]
-			namespaceName[index + 1] != ':')		//or the namespace separation was : instead of ::
+		if (name.size() <= index + 2u ||	//The provided namespace name either ends with : or :[some char]
+			name[index + 1] != ':')			//or the namespace separation was : instead of ::
 		{
 			throw BadNamespaceFormat("The provided namespace name is ill formed.");
 		}
 
 		//Remove namespace separation :: 
-		namespaceName	= namespaceName.substr(index + 2u);
-		index			= namespaceName.find_first_of(':');
+		name	= name.substr(index + 2u);
+		index	= name.find_first_of(':');
 
-		result = result->getNamespaceByName(namespaceName.substr(0u, index).data());
+		result = Algorithm::getEntityByName(result->getPimpl()->getNamespaces(), name.substr(0u, index));
 	}
 
 	return result;
@@ -73,21 +182,29 @@ Namespace const* Database::getNamespaceByName(char const* name) const
 
 Namespace const* Database::getFileLevelNamespaceByPredicate(Predicate<Namespace> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelNamespacesByName(), predicate, userData);
 }
 
 Vector<Namespace const*> Database::getFileLevelNamespacesByPredicate(Predicate<Namespace>	predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelNamespacesByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelNamespace(Visitor<Namespace> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelNamespacesByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelNamespacesCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelNamespacesByName().size();
 }
 
@@ -98,6 +215,13 @@ Archetype const* Database::getArchetypeById(std::size_t id) const noexcept
 
 Archetype const* Database::getFileLevelArchetypeByName(char const* name) const noexcept
 {
+	return (name != nullptr) ? getFileLevelArchetypeByName(std::string_view(name)) : nullptr;
+}
+
+Archetype const* Database::getFileLevelArchetypeByName(std::string_view name) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	Archetype const* result = getFileLevelClassByName(name);
 
 	if (result == nullptr)
@@ -120,6 +244,8 @@ Archetype const* Database::getFileLevelArchetypeByName(char const* name) const n
 
 Vector<Archetype const*> Database::getFileLevelArchetypesByPredicate(Predicate<Archetype> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	Vector<Archetype const*> result = Algorithm::getItemsByPredicate(_pimpl->getFileLevelEnumsByName(), predicate, userData);
 
 	result.push_back(Algorithm::getItemsByPredicate(_pimpl->getFileLevelStructsByName(), predicate, userData));
@@ -137,26 +263,41 @@ Struct const* Database::getStructById(std::size_t id) const noexcept
 
 Struct const* Database::getFileLevelStructByName(char const* name) const noexcept
 {
+	return (name != nullptr) ? getFileLevelStructByName(std::string_view(name)) : nullptr;
+}
+
+Struct const* Database::getFileLevelStructByName(std::string_view name) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByName(_pimpl->getFileLevelStructsByName(), name);
 }
 
 Struct const* Database::getFileLevelStructByPredicate(Predicate<Struct>	predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelStructsByName(), predicate, userData);
 }
 
 Vector<Struct const*> Database::getFileLevelStructsByPredicate(Predicate<Struct> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelStructsByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelStruct(Visitor<Struct> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelStructsByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelStructsCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelStructsByName().size();
 }
 
@@ -167,26 +308,41 @@ Class const* Database::getClassById(std::size_t id) const noexcept
 
 Class const* Database::getFileLevelClassByName(char const* name) const noexcept
 {
+	return (name != nullptr) ? getFileLevelClassByName(std::string_view(name)) : nullptr;
+}
+
+Class const* Database::getFileLevelClassByName(std::string_view name) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByName(_pimpl->getFileLevelClassesByName(), name);
 }
 
 Struct const* Database::getFileLevelClassByPredicate(Predicate<Struct>	predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelClassesByName(), predicate, userData);
 }
 
 Vector<Class const*> Database::getFileLevelClassesByPredicate(Predicate<Class> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelClassesByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelClass(Visitor<Class> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelClassesByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelClassesCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelClassesByName().size();
 }
 
@@ -197,26 +353,41 @@ Enum const* Database::getEnumById(std::size_t id) const noexcept
 
 Enum const* Database::getFileLevelEnumByName(char const* name) const noexcept
 {
+	return (name != nullptr) ? getFileLevelEnumByName(std::string_view(name)) : nullptr;
+}
+
+Enum const* Database::getFileLevelEnumByName(std::string_view name) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByName(_pimpl->getFileLevelEnumsByName(), name);
 }
 
 Enum const* Database::getFileLevelEnumByPredicate(Predicate<Enum> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelEnumsByName(), predicate, userData);
 }
 
 Vector<Enum const*> Database::getFileLevelEnumsByPredicate(Predicate<Enum> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelEnumsByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelEnum(Visitor<Enum> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelEnumsByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelEnumsCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelEnumsByName().size();
 }
 
@@ -227,6 +398,13 @@ FundamentalArchetype const* Database::getFundamentalArchetypeById(std::size_t id
 
 FundamentalArchetype const* Database::getFundamentalArchetypeByName(char const* name) const noexcept
 {
+	return (name != nullptr) ? getFundamentalArchetypeByName(std::string_view(name)) : nullptr;
+}
+
+FundamentalArchetype const* Database::getFundamentalArchetypeByName(std::string_view name) const noexcept
+{
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByName(_pimpl->getFundamentalArchetypesByName(), name);
 }
 
@@ -237,6 +415,8 @@ Variable const* Database::getVariableById(std::size_t id) const noexcept
 
 Variable const* Database::getFileLevelVariableByName(char const* name, EVarFlags flags) const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelVariablesByName(),
 													  name,
 													  [flags](Variable const& var) { return (var.getFlags() & flags) == flags; });
@@ -244,21 +424,29 @@ Variable const* Database::getFileLevelVariableByName(char const* name, EVarFlags
 
 Variable const* Database::getFileLevelVariableByPredicate(Predicate<Variable> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelVariablesByName(), predicate, userData);
 }
 
 Vector<Variable const*> Database::getFileLevelVariablesByPredicate(Predicate<Variable> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelVariablesByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelVariable(Visitor<Variable> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelVariablesByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelVariablesCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelVariablesByName().size();
 }
 
@@ -269,6 +457,8 @@ Function const* Database::getFunctionById(std::size_t id) const noexcept
 
 Function const* Database::getFileLevelFunctionByName(char const* name, EFunctionFlags flags) const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntityByNameAndPredicate(_pimpl->getFileLevelFunctionsByName(),
 													  name,
 													  [flags](Function const& func) { return (func.getFlags() & flags) == flags; });
@@ -276,6 +466,8 @@ Function const* Database::getFileLevelFunctionByName(char const* name, EFunction
 
 Vector<Function const*> Database::getFileLevelFunctionsByName(char const* name, EFunctionFlags flags) const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getEntitiesByNameAndPredicate(_pimpl->getFileLevelFunctionsByName(),
 														name,
 														[flags](Function const& func) { return (func.getFlags() & flags) == flags; });
@@ -283,21 +475,29 @@ Vector<Function const*> Database::getFileLevelFunctionsByName(char const* name,
 
 Function const* Database::getFileLevelFunctionByPredicate(Predicate<Function> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemByPredicate(_pimpl->getFileLevelFunctionsByName(), predicate, userData);
 }
 
 Vector<Function const*> Database::getFileLevelFunctionsByPredicate(Predicate<Function> predicate, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::getItemsByPredicate(_pimpl->getFileLevelFunctionsByName(), predicate, userData);
 }
 
 bool Database::foreachFileLevelFunction(Visitor<Function> visitor, void* userData) const
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return Algorithm::foreach(_pimpl->getFileLevelFunctionsByName(), visitor, userData);
 }
 
 std::size_t Database::getFileLevelFunctionsCount() const noexcept
 {
+	DatabaseImpl::ReadLockGuard lock(*_pimpl);
+
 	return _pimpl->getFileLevelFunctionsByName().size();
 }
 
@@ -24,31 +24,12 @@ Property const* Entity::getPropertyAt(std::size_t propertyIndex) const noexcept
 
 Property const* Entity::getProperty(Struct const& archetype, bool isChildClassValid) const noexcept
 {
-	//Iterate over all props to find a matching property
-	if (isChildClassValid)
-	{
-		for (Property const* p : _pimpl->getProperties())
-		{
-			//Consider child classes as valid
-			if (archetype.isBaseOf(p->getArchetype()))
-			{
-				return p;
-			}
-		}
-	}
-	else
-	{
-		for (Property const* p : _pimpl->getProperties())
-		{
-			//Child classes are not considered
-			if (archetype == p->getArchetype())
-			{
-				return p;
-			}
-		}
-	}
+	return _pimpl->getProperty(archetype, isChildClassValid);
+}
 
-	return nullptr;
+bool Entity::hasProperty(Struct const& archetype, bool isChildClassValid) const noexcept
+{
+	return _pimpl->getProperty(archetype, isChildClassValid) != nullptr;
 }
 
 Property const* Entity::getPropertyByName(char const* name) const noexcept
@@ -68,6 +49,12 @@ Vector<Property const*> Entity::getProperties(Struct const& archetype, bool isCh
 {
 	Vector<Property const*> result;
 
+	//Early exit without iterating if no property matches
+	if (_pimpl->getProperty(archetype, true) == nullptr)
+	{
+		return result;
+	}
+
 	//Iterate over all props to find a matching property
 	if (isChildClassValid)
 	{
@@ -128,6 +115,11 @@ char const* Entity::getName() const noexcept
 	return _pimpl->getName().data();
 }
 
+std::size_t Entity::getNameHash() const noexcept
+{
+	return _pimpl->getNameHash();
+}
+
 bool Entity::hasSameName(char const* name) const noexcept
 {
 	return name != nullptr && std::strcmp(getName(), name) == 0;
@@ -1,6 +1,5 @@
 #include "Refureku/TypeInfo/Entity/EntityHash.h"
 
-#include <string_view>
 #include <cstring>		//std::strcmp
 
 #include "Refureku/TypeInfo/Entity/Entity.h"
@@ -9,7 +8,7 @@ using namespace rfk;
 
 std::size_t EntityNameHash::operator()(Entity const& entity) const
 {
-	return std::hash<std::string_view>()(entity.getName());
+	return entity.getNameHash();
 }
 
 std::size_t EntityIdHash::operator()(Entity const& entity) const
@@ -19,7 +18,8 @@ std::size_t EntityIdHash::operator()(Entity const& entity) const
 
 bool EntityNameEqual::operator()(Entity const& lhs, Entity const& rhs) const
 {
-	return std::strcmp(lhs.getName(), rhs.getName()) == 0;
+	//Compare the precomputed hashes first to avoid most string comparisons
+	return lhs.getNameHash() == rhs.getNameHash() && std::strcmp(lhs.getName(), rhs.getName()) == 0;
 }
 
 bool EntityIdEqual::operator()(Entity const& lhs, Entity const& rhs) const
@@ -29,7 +29,7 @@ bool EntityIdEqual::operator()(Entity const& lhs, Entity const& rhs) const
 
 std::size_t EntityPtrNameHash::operator()(Entity const* entity) const
 {
-	return std::hash<std::string_view>()(entity->getName());
+	return entity->getNameHash();
 }
 
 std::size_t EntityPtrIdHash::operator()(Entity const* entity) const
@@ -39,7 +39,8 @@ std::size_t EntityPtrIdHash::operator()(Entity const* entity) const
 
 bool EntityPtrNameEqual::operator()(Entity const* lhs, Entity const* rhs)	const
 {
-	return std::strcmp(lhs->getName(), rhs->getName()) == 0;
+	//Compare the precomputed hashes first to avoid most string comparisons
+	return lhs->getNameHash() == rhs->getNameHash() && std::strcmp(lhs->getName(), rhs->getName()) == 0;
 }
 
 bool EntityPtrIdEqual::operator()(Entity const* lhs, Entity const* rhs) const
@@ -0,0 +1,10 @@
+#include "Refureku/TypeInfo/Entity/EntityName.h"
+
+#include <cstring>	//std::strlen
+
+using namespace rfk;
+
+EntityName::EntityName(char const* name) noexcept:
+	EntityName(name, (name != nullptr) ? std::strlen(name) : 0u, false)
+{
+}
\ No newline at end of file
@@ -11,13 +11,18 @@ template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Function const*, rfk::Alloc
 
 using EFunctionFlagsUnderlyingType = std::underlying_type_t<EFunctionFlags>;
 
-Function::Function(char const* name, std::size_t id, Type const& returnType, ICallable* internalFunction, EFunctionFlags flags) noexcept:
+Function::Function(EntityName name, std::size_t id, Type const& returnType, ICallable* internalFunction, EFunctionFlags flags) noexcept:
 	FunctionBase(new FunctionImpl(name, id, returnType, internalFunction, flags))
 {
 }
 
 Function::~Function() noexcept = default;
 
+void Function::invokeErased(void* const* args, void* returnSlot) const
+{
+	getInternalFunction()->invokeErased(nullptr, args, returnSlot);
+}
+
 bool Function::isInline() const noexcept
 {
 	return static_cast<EFunctionFlagsUnderlyingType>(getFlags() & EFunctionFlags::Inline) != static_cast<EFunctionFlagsUnderlyingType>(0);
@@ -18,13 +18,19 @@ FunctionBase::FunctionBase(FunctionBase&&) noexcept = default;
 
 FunctionBase::~FunctionBase() noexcept = default;
 
-FunctionParameter& FunctionBase::addParameter(char const* name, std::size_t id, Type const& type) noexcept
+FunctionParameter& FunctionBase::addParameter(EntityName name, std::size_t id, Type const& type) noexcept
 {
 	return getPimpl()->addParameter(name, id, type, this);
 }
 
 bool FunctionBase::hasSameSignature(FunctionBase const& other) const noexcept
 {
+	//Different fingerprints always mean different signatures
+	if (getSignatureFingerprint() != other.getSignatureFingerprint())
+	{
+		return false;
+	}
+
 	//Compare return type
 	if (getReturnType() != other.getReturnType())
 	{
@@ -69,6 +75,29 @@ void FunctionBase::setParametersCapacity(std::size_t capacity) noexcept
 	return getPimpl()->setParametersCapacity(capacity);
 }
 
+uint64 FunctionBase::getSignatureFingerprint() const noexcept
+{
+	return getPimpl()->getSignatureFingerprint();
+}
+
+uint64 FunctionBase::combineSignatureFingerprint(uint64 fingerprint, Type const& type) noexcept
+{
+	//FNV-1a over the bytes describing the type: archetype address, type parts count and type parts
+	Archetype const*	archetype		= type.getArchetype();
+	std::size_t			typePartsCount	= type.getTypePartsCount();
+
+	fingerprint = combineHashBytes(fingerprint, &archetype, sizeof(archetype));
+	fingerprint = combineHashBytes(fingerprint, &typePartsCount, sizeof(typePartsCount));
+
+	for (std::size_t i = 0u; i < typePartsCount; i++)
+	{
+		//TypePart is made of fully initialized memory, so its bytes can be hashed directly
+		fingerprint = combineHashBytes(fingerprint, &type.getTypePartAt(i), sizeof(TypePart));
+	}
+
+	return fingerprint;
+}
+
 ICallable* FunctionBase::getInternalFunction() const noexcept
 {
 	return getPimpl()->getInternalFunction();
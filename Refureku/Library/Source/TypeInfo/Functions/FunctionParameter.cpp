@@ -4,7 +4,7 @@
 
 using namespace rfk;
 
-FunctionParameter::FunctionParameter(char const* name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
+FunctionParameter::FunctionParameter(EntityName name, std::size_t id, Type const& type, Entity const* outerEntity) noexcept:
 	Entity(new FunctionParameterImpl(name, id, type, outerEntity))
 {
 }
@@ -12,7 +12,7 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Method const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Method const*, rfk::Allocator<Method const*>>;
 
-Method::Method(char const* name, std::size_t id, Type const& returnType,
+Method::Method(EntityName name, std::size_t id, Type const& returnType,
 					 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
 	MethodBase(new MethodImpl(name, id, returnType, internalMethod, flags, outerEntity))
 {
@@ -61,6 +61,22 @@ void Method::inheritBaseMethodProperties() noexcept
 	}
 }
 
+void Method::invokeErased(void* caller, void* const* args, void* returnSlot) const
+{
+	getInternalFunction()->invokeErased(caller, args, returnSlot);
+}
+
+void Method::invokeErased(void const* caller, void* const* args, void* returnSlot) const
+{
+	if (!isConst())
+	{
+		throwConstViolationException();
+	}
+
+	//The const method never modifies the caller
+	getInternalFunction()->invokeErased(const_cast<void*>(caller), args, returnSlot);
+}
+
 void Method::throwConstViolationException() const
 {
 	throw ConstViolation("Can't call a non-const member function on a const caller instance.");
@@ -7,7 +7,7 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<StaticMethod const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<StaticMethod const*, rfk::Allocator<StaticMethod const*>>;
 
-StaticMethod::StaticMethod(char const* name, std::size_t id, Type const& returnType,
+StaticMethod::StaticMethod(EntityName name, std::size_t id, Type const& returnType,
 								 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
 	MethodBase(new StaticMethodImpl(name, id, returnType, internalMethod, flags, outerEntity))
 {
@@ -15,4 +15,9 @@ StaticMethod::StaticMethod(char const* name, std::size_t id, Type const& returnT
 
 StaticMethod::StaticMethod(StaticMethod&&) noexcept = default;
 
-StaticMethod::~StaticMethod() noexcept = default;
\ No newline at end of file
+StaticMethod::~StaticMethod() noexcept = default;
+
+void StaticMethod::invokeErased(void* const* args, void* returnSlot) const
+{
+	getInternalFunction()->invokeErased(nullptr, args, returnSlot);
+}
\ No newline at end of file
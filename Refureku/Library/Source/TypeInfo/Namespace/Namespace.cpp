@@ -1,6 +1,7 @@
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 
 #include "Refureku/TypeInfo/Namespace/NamespaceImpl.h"
+#include "Refureku/TypeInfo/DatabaseImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/Misc/Algorithm.h"
@@ -10,7 +11,7 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Namespace const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Namespace const*, rfk::Allocator<Namespace const*>>;
 
-Namespace::Namespace(char const* name, std::size_t id) noexcept:
+Namespace::Namespace(EntityName name, std::size_t id) noexcept:
 	Entity(new NamespaceImpl(name, id))
 {
 }
@@ -19,11 +20,15 @@ Namespace::~Namespace() noexcept = default;
 
 Namespace const* Namespace::getNamespaceByName(char const* name) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::getEntityByName(getPimpl()->getNamespaces(), name);
 }
 
 Namespace const* Namespace::getNamespaceByPredicate(Predicate<Namespace> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemByPredicate(getPimpl()->getNamespaces(), [predicate, userData](Namespace const& n){ return predicate(n, userData); }) :
 		nullptr;
@@ -31,6 +36,8 @@ Namespace const* Namespace::getNamespaceByPredicate(Predicate<Namespace> predica
 
 Vector<Namespace const*> Namespace::getNamespacesByPredicate(Predicate<Namespace> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemsByPredicate(getPimpl()->getNamespaces(),
 											  [predicate, userData](Namespace const& n)
@@ -41,16 +48,22 @@ Vector<Namespace const*> Namespace::getNamespacesByPredicate(Predicate<Namespace
 
 bool Namespace::foreachNamespace(Visitor<Namespace> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::foreach(getPimpl()->getNamespaces(), visitor, userData);
 }
 
 std::size_t Namespace::getNamespacesCount() const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return getPimpl()->getNamespaces().size();
 }
 
 Struct const* Namespace::getStructByName(char const* name) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return reinterpret_cast<Struct const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
@@ -59,6 +72,8 @@ Struct const* Namespace::getStructByName(char const* name) const noexcept
 
 Struct const* Namespace::getStructByPredicate(Predicate<Struct> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		reinterpret_cast<Struct const*>(
 			Algorithm::getItemByPredicate(getPimpl()->getArchetypes(),
@@ -71,6 +86,8 @@ Struct const* Namespace::getStructByPredicate(Predicate<Struct> predicate, void*
 
 Vector<Struct const*> Namespace::getStructsByPredicate(Predicate<Struct> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	if (predicate != nullptr)
 	{
 		return Algorithm::getItemsByPredicate(getPimpl()->getArchetypes(),
@@ -88,6 +105,8 @@ Vector<Struct const*> Namespace::getStructsByPredicate(Predicate<Struct> predica
 
 bool Namespace::foreachStruct(Visitor<Struct> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (visitor != nullptr) ? 
 		Algorithm::foreach(getPimpl()->getArchetypes(), [visitor, userData](Archetype const& archetype)
 																	{
@@ -100,6 +119,8 @@ bool Namespace::foreachStruct(Visitor<Struct> visitor, void* userData) const
 
 Class const* Namespace::getClassByName(char const* name) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return reinterpret_cast<Class const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
@@ -108,6 +129,8 @@ Class const* Namespace::getClassByName(char const* name) const noexcept
 
 Class const* Namespace::getClassByPredicate(Predicate<Class> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		reinterpret_cast<Struct const*>(
 			Algorithm::getItemByPredicate(getPimpl()->getArchetypes(),
@@ -120,6 +143,8 @@ Class const* Namespace::getClassByPredicate(Predicate<Class> predicate, void* us
 
 Vector<Class const*> Namespace::getClassesByPredicate(Predicate<Class> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	if (predicate != nullptr)
 	{
 		return Algorithm::getItemsByPredicate(getPimpl()->getArchetypes(),
@@ -137,6 +162,8 @@ Vector<Class const*> Namespace::getClassesByPredicate(Predicate<Class> predicate
 
 bool Namespace::foreachClass(Visitor<Class> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (visitor != nullptr) ? 
 		Algorithm::foreach(getPimpl()->getArchetypes(), [visitor, userData](Archetype const& archetype)
 									 {
@@ -149,6 +176,8 @@ bool Namespace::foreachClass(Visitor<Class> visitor, void* userData) const
 
 Enum const* Namespace::getEnumByName(char const* name) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return reinterpret_cast<Enum const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getArchetypes(),
 													name,
@@ -157,6 +186,8 @@ Enum const* Namespace::getEnumByName(char const* name) const noexcept
 
 Enum const* Namespace::getEnumByPredicate(Predicate<Enum> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		reinterpret_cast<Enum const*>(
 			Algorithm::getItemByPredicate(getPimpl()->getArchetypes(),
@@ -169,6 +200,8 @@ Enum const* Namespace::getEnumByPredicate(Predicate<Enum> predicate, void* userD
 
 Vector<Enum const*> Namespace::getEnumsByPredicate(Predicate<Enum> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	if (predicate != nullptr)
 	{
 		return Algorithm::getItemsByPredicate(getPimpl()->getArchetypes(),
@@ -186,6 +219,8 @@ Vector<Enum const*> Namespace::getEnumsByPredicate(Predicate<Enum> predicate, vo
 
 bool Namespace::foreachEnum(Visitor<Enum> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (visitor != nullptr) ? 
 		Algorithm::foreach(getPimpl()->getArchetypes(), [visitor, userData](Archetype const& archetype)
 									 {
@@ -198,16 +233,22 @@ bool Namespace::foreachEnum(Visitor<Enum> visitor, void* userData) const
 
 bool Namespace::foreachArchetype(Visitor<Archetype> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::foreach(getPimpl()->getArchetypes(), visitor, userData);
 }
 
 std::size_t Namespace::getArchetypesCount() const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return getPimpl()->getArchetypes().size();
 }
 
 Variable const* Namespace::getVariableByName(char const* name, EVarFlags flags) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return reinterpret_cast<Variable const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getVariables(),
 													name,
@@ -216,6 +257,8 @@ Variable const* Namespace::getVariableByName(char const* name, EVarFlags flags)
 
 Variable const* Namespace::getVariableByPredicate(Predicate<Variable> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemByPredicate(getPimpl()->getVariables(),
 		[predicate, userData](Variable const& variable)
@@ -226,6 +269,8 @@ Variable const* Namespace::getVariableByPredicate(Predicate<Variable> predicate,
 
 Vector<Variable const*> Namespace::getVariablesByPredicate(Predicate<Variable> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemsByPredicate(getPimpl()->getVariables(),
 											  [predicate, userData](Variable const& variable)
@@ -236,16 +281,22 @@ Vector<Variable const*> Namespace::getVariablesByPredicate(Predicate<Variable> p
 
 bool Namespace::foreachVariable(Visitor<Variable> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::foreach(getPimpl()->getVariables(), visitor, userData);
 }
 
 std::size_t Namespace::getVariablesCount() const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return getPimpl()->getVariables().size();
 }
 
 Function const* Namespace::getFunctionByName(char const* name, EFunctionFlags flags) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return reinterpret_cast<Function const*>(
 		Algorithm::getEntityByNameAndPredicate(getPimpl()->getFunctions(),
 													name,
@@ -257,6 +308,8 @@ Function const* Namespace::getFunctionByName(char const* name, EFunctionFlags fl
 
 Vector<Function const*> Namespace::getFunctionsByName(char const* name, EFunctionFlags flags) const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::getEntitiesByNameAndPredicate(getPimpl()->getFunctions(),
 														name,
 														[flags](Function const& func)
@@ -267,6 +320,8 @@ Vector<Function const*> Namespace::getFunctionsByName(char const* name, EFunctio
 
 Function const* Namespace::getFunctionByPredicate(Predicate<Function> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemByPredicate(getPimpl()->getFunctions(),
 											[predicate, userData](Function const& function)
@@ -277,6 +332,8 @@ Function const* Namespace::getFunctionByPredicate(Predicate<Function> predicate,
 
 Vector<Function const*> Namespace::getFunctionsByPredicate(Predicate<Function> predicate, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return (predicate != nullptr) ?
 		Algorithm::getItemsByPredicate(getPimpl()->getFunctions(),
 											  [predicate, userData](Function const& function)
@@ -287,11 +344,15 @@ Vector<Function const*> Namespace::getFunctionsByPredicate(Predicate<Function> p
 
 bool Namespace::foreachFunction(Visitor<Function> visitor, void* userData) const
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return Algorithm::foreach(getPimpl()->getFunctions(), visitor, userData);
 }
 
 std::size_t Namespace::getFunctionsCount() const noexcept
 {
+	Database::DatabaseImpl::ReadLockGuard lock(*Database::getInstance()._pimpl);
+
 	return getPimpl()->getFunctions().size();
 }
 
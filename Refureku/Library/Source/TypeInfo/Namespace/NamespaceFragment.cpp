@@ -1,25 +1,35 @@
 #include "Refureku/TypeInfo/Namespace/NamespaceFragment.h"
 
+#include <cassert>
+
 #include "Refureku/TypeInfo/DatabaseImpl.h"
 #include "Refureku/TypeInfo/Namespace/NamespaceFragmentImpl.h"
 #include "Refureku/Misc/Algorithm.h"
 
 using namespace rfk;
 
-NamespaceFragment::NamespaceFragment(char const* name, std::size_t id) noexcept:
-	Entity(new NamespaceFragmentImpl(name, id, Database::getInstance()._pimpl->getOrCreateNamespace(name, id)))
+NamespaceFragment::NamespaceFragment(EntityName name, std::size_t id) noexcept:
+	Entity(new NamespaceFragmentImpl(name, id))
 {
+	//Make sure the database is constructed before (so destroyed after) this fragment,
+	//since the fragment destructor releases its merged namespace from the database
+	Database::getInstance();
 }
 
 NamespaceFragment::~NamespaceFragment() noexcept
 {
 	//Check if this namespace fragment was the last fragment of the merged namespace
 	//If this is the case, the namespace will be completely removed from the database
-	Database::getInstance()._pimpl->releaseNamespaceIfUnreferenced(getPimpl()->getMergedNamespace());
+	if (getPimpl()->getMergedNamespace() != nullptr)
+	{
+		Database::getInstance()._pimpl->releaseNamespaceIfUnreferenced(getPimpl()->getMergedNamespace());
+	}
 }
 
 void NamespaceFragment::addNestedEntity(Entity const& nestedEntity) noexcept
 {
+	//Fragments are filled under their initialization guard, so they must not take the database lock here.
+	//The merged namespace is updated when the fragment is registered, see mergeFragment.
 	getPimpl()->addNestedEntity(nestedEntity);
 }
 
@@ -30,11 +40,37 @@ void NamespaceFragment::setNestedEntitiesCapacity(std::size_t capacity) noexcept
 
 bool NamespaceFragment::addProperty(Property const& property) noexcept
 {
-	return getPimpl()->addProperty(property);
+	//Fragments are filled under their initialization guard before being merged, so they must not take the database lock here.
+	//The properties of a fragment which is not merged yet are added to the merged namespace by mergeFragment.
+	if (getPimpl()->getMergedNamespace() == nullptr)
+	{
+		return Entity::addProperty(property);
+	}
+
+	//Merged namespaces content is protected by the database lock
+	Database::DatabaseImpl& database = *Database::getInstance()._pimpl;
+	Database::DatabaseImpl::WriteLockGuard lock(database);
+
+	if (!Entity::addProperty(property))
+	{
+		return false;
+	}
+
+	Namespace& mergedNamespace = *getPimpl()->getMergedNamespace().get();
+
+	if (mergedNamespace.addProperty(property))
+	{
+		database.registerEntityAddedProperty(mergedNamespace, property);
+	}
+
+	return true;
 }
 
 Namespace const& NamespaceFragment::getMergedNamespace() const noexcept
 {
+	//The merged namespace is only set once the fragment is registered
+	assert(getPimpl()->getMergedNamespace() != nullptr);
+
 	return *getPimpl()->getMergedNamespace().get();
 }
 
@@ -43,7 +79,27 @@ bool NamespaceFragment::foreachNestedEntity(Visitor<Entity> visitor, void* userD
 	return Algorithm::foreach(getPimpl()->getNestedEntities(), visitor, userData);
 }
 
+void NamespaceFragment::mergeFragment() const noexcept
+{
+	Database::DatabaseImpl& database = *Database::getInstance()._pimpl;
+
+	assert(database.ownsWriteLock());
+
+	//Merge nested fragments first so that their merged namespace exists
+	for (Entity const* entity : getPimpl()->getNestedEntities())
+	{
+		if (entity->getKind() == EEntityKind::NamespaceFragment)
+		{
+			static_cast<NamespaceFragment const*>(entity)->mergeFragment();
+		}
+	}
+
+	getPimpl()->mergeFragment(database.getOrCreateNamespace(getName(), getId()));
+}
+
 void NamespaceFragment::unmergeFragment() const noexcept
 {
+	Database::DatabaseImpl::WriteLockGuard lock(*Database::getInstance()._pimpl);
+
 	getPimpl()->unmergeFragment();
 }
\ No newline at end of file
@@ -1,86 +1,168 @@
 #include "Refureku/TypeInfo/Type.h"
 
-#include <cstring>	//std::memcmp
+#include <cstring>			//std::memcmp, std::memcpy
+#include <unordered_set>
 
-#include "Refureku/TypeInfo/TypeImpl.h"
+#include "Refureku/Misc/EntityIdHash.h"
 
 using namespace rfk;
 
-Type::Type() noexcept:
-	_pimpl{new TypeImpl()}
+Type::Type() noexcept = default;
+
+Type::Type(Type const& other) noexcept
 {
+	copyFrom(other);
 }
 
-Type::Type(Type const& other) noexcept:
-	_pimpl{other._pimpl}
+Type::Type(Type&& other) noexcept:
+	_spilledParts{other._spilledParts},
+	_partsCount{other._partsCount},
+	_spilledPartsCapacity{other._spilledPartsCapacity},
+	_archetype{other._archetype}
 {
+	std::memcpy(_inlineParts, other._inlineParts, sizeof(_inlineParts));
+
+	other._spilledParts			= nullptr;
+	other._partsCount			= 0u;
+	other._spilledPartsCapacity	= 0u;
 }
 
-Type::Type(Type&& other) noexcept:
-	_pimpl{std::forward<Pimpl<TypeImpl>>(other._pimpl)}
+Type::~Type() noexcept
+{
+	delete[] _spilledParts;
+}
+
+void Type::copyFrom(Type const& other) noexcept
 {
+	//Only spill if the parts don't fit in the inline storage
+	if (other._partsCount > _inlinePartsCapacity && other._partsCount > _spilledPartsCapacity)
+	{
+		delete[] _spilledParts;
+
+		_spilledParts			= new TypePart[other._partsCount];
+		_spilledPartsCapacity	= other._partsCount;
+	}
+
+	_partsCount	= other._partsCount;
+	_archetype	= other._archetype;
+
+	std::memcpy(getParts(), other.getParts(), _partsCount * sizeof(TypePart));
 }
 
-Type::~Type() noexcept = default;
+TypePart* Type::getParts() noexcept
+{
+	return (_partsCount > _inlinePartsCapacity) ? _spilledParts : _inlineParts;
+}
+
+TypePart const* Type::getParts() const noexcept
+{
+	return (_partsCount > _inlinePartsCapacity) ? _spilledParts : _inlineParts;
+}
 
 void Type::optimizeMemory() noexcept
 {
-	_pimpl->optimizeMemory();
+	if (_spilledPartsCapacity > _partsCount)
+	{
+		if (_partsCount > _inlinePartsCapacity)
+		{
+			TypePart* parts = new TypePart[_partsCount];
+
+			std::memcpy(parts, _spilledParts, _partsCount * sizeof(TypePart));
+
+			delete[] _spilledParts;
+			_spilledParts = parts;
+			_spilledPartsCapacity = _partsCount;
+		}
+		else
+		{
+			//The parts are stored inline, the spilled parts are not used anymore
+			delete[] _spilledParts;
+			_spilledParts = nullptr;
+			_spilledPartsCapacity = 0u;
+		}
+	}
 }
 
 TypePart& Type::addTypePart() noexcept
 {
-	return _pimpl->addTypePart();
+	if (_partsCount < _inlinePartsCapacity)
+	{
+		_inlineParts[_partsCount] = TypePart();
+
+		return _inlineParts[_partsCount++];
+	}
+
+	if (_partsCount >= _spilledPartsCapacity)
+	{
+		//Spill the parts to a bigger dynamically allocated storage, growing geometrically
+		uint32		newCapacity	= _partsCount * 2u;
+		TypePart*	parts		= new TypePart[newCapacity];
+
+		std::memcpy(parts, getParts(), _partsCount * sizeof(TypePart));
+
+		delete[] _spilledParts;
+		_spilledParts = parts;
+		_spilledPartsCapacity = newCapacity;
+	}
+	else if (_partsCount == _inlinePartsCapacity)
+	{
+		//The spilled storage is big enough already, only move the inline parts to it
+		std::memcpy(_spilledParts, _inlineParts, sizeof(_inlineParts));
+	}
+
+	_spilledParts[_partsCount] = TypePart();
+
+	return _spilledParts[_partsCount++];
 }
 
 TypePart const& Type::getTypePartAt(std::size_t index) const noexcept
 {
-	return _pimpl->getParts()[index];
+	return getParts()[index];
 }
 
 std::size_t Type::getTypePartsCount() const noexcept
 {
-	return _pimpl->getParts().size();
+	return _partsCount;
 }
 
 bool Type::isPointer() const noexcept
 {
-	return _pimpl->getParts().front().isPointer();
+	return getParts()[0].isPointer();
 }
 
 bool Type::isLValueReference() const	noexcept
 {
-	return _pimpl->getParts().front().isLValueReference();
+	return getParts()[0].isLValueReference();
 }
 
 bool Type::isRValueReference() const	noexcept
 {
-	return _pimpl->getParts().front().isRValueReference();
+	return getParts()[0].isRValueReference();
 }
 
 bool Type::isCArray() const noexcept
 {
-	return _pimpl->getParts().front().isCArray();
+	return getParts()[0].isCArray();
 }
 
 bool Type::isValue() const noexcept
 {
-	return _pimpl->getParts().front().isValue();
+	return getParts()[0].isValue();
 }
 
 bool Type::isConst() const noexcept
 {
-	return _pimpl->getParts().front().isConst();
+	return getParts()[0].isConst();
 }
 
 bool Type::isVolatile() const noexcept
 {
-	return _pimpl->getParts().front().isVolatile();
+	return getParts()[0].isVolatile();
 }
 
 uint32 Type::getCArraySize() const noexcept
 {
-	return _pimpl->getParts().front().getCArraySize();
+	return getParts()[0].getCArraySize();
 }
 
 bool Type::match(Type const& other) const noexcept
@@ -92,23 +174,83 @@ bool Type::match(Type const& other) const noexcept
 
 Archetype const* Type::getArchetype() const noexcept
 {
-	return _pimpl->getArchetype();
+	return _archetype;
 }
 
 void Type::setArchetype(Archetype const* archetype) noexcept
 {
-	_pimpl->setArchetype(archetype);
+	_archetype = archetype;
 }
 
 bool Type::operator==(Type const& type) const noexcept
 {
 	return	(this == &type) ||
-			(_pimpl->getArchetype() == type.getArchetype() &&
-			_pimpl->getParts().size() == type._pimpl->getParts().size() &&
-			std::memcmp(_pimpl->getParts().data(), type._pimpl->getParts().data(), _pimpl->getParts().size() * sizeof(TypePart)) == 0);
+			(!(_isCanonical && type._isCanonical) &&	//2 different canonical instances always describe different types
+			_archetype == type._archetype &&
+			_partsCount == type._partsCount &&
+			std::memcmp(getParts(), type.getParts(), _partsCount * sizeof(TypePart)) == 0);
 }
 
 bool Type::operator!=(Type const& type) const noexcept
 {
 	return !(*this == type);
+}
+
+Type& Type::operator=(Type const& other) noexcept
+{
+	if (this != &other)
+	{
+		copyFrom(other);
+	}
+
+	return *this;
+}
+
+Type& Type::operator=(Type&& other) noexcept
+{
+	if (this != &other)
+	{
+		delete[] _spilledParts;
+
+		std::memcpy(_inlineParts, other._inlineParts, sizeof(_inlineParts));
+		_spilledParts			= other._spilledParts;
+		_partsCount				= other._partsCount;
+		_spilledPartsCapacity	= other._spilledPartsCapacity;
+		_archetype				= other._archetype;
+
+		other._spilledParts			= nullptr;
+		other._partsCount			= 0u;
+		other._spilledPartsCapacity	= 0u;
+	}
+
+	return *this;
+}
+
+Type const& Type::getCanonicalType(Type const& type) noexcept
+{
+	//The table is only accessed while initializing a getType<T> result, so accesses are serialized by the initialization guard mutex.
+	//std::unordered_set never moves its elements, so returned references stay valid when the table grows.
+	auto hashType = [](Type const& hashedType) { return hashedType.computeHash(); };
+
+	static std::unordered_set<Type, decltype(hashType)> canonicalTypes(0u, hashType);
+
+	auto [it, inserted] = canonicalTypes.insert(type);
+
+	if (inserted)
+	{
+		//The flag is not part of the hash nor of the equality, so it can be modified in place
+		const_cast<Type&>(*it)._isCanonical = true;
+	}
+
+	return *it;
+}
+
+std::size_t Type::computeHash() const noexcept
+{
+	uint64 result = combineHashBytes(fnv1aOffsetBasis, &_archetype, sizeof(_archetype));
+
+	//TypePart is made of fully initialized memory, so its bytes can be hashed directly
+	result = combineHashBytes(result, getParts(), _partsCount * sizeof(TypePart));
+
+	return static_cast<std::size_t>(result);
 }
\ No newline at end of file
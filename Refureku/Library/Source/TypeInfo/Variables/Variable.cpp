@@ -8,12 +8,12 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Variable const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Variable const*, rfk::Allocator<Variable const*>>;
 
-Variable::Variable(char const* name, std::size_t id, Type const& type, void* ptr, EVarFlags flags) noexcept:
+Variable::Variable(EntityName name, std::size_t id, Type const& type, void* ptr, EVarFlags flags) noexcept:
 	VariableBase(new VariableImpl(name, id, type, ptr, flags))
 {
 }
 
-Variable::Variable(char const* name, std::size_t id, Type const& type, void const* constPtr, EVarFlags flags) noexcept:
+Variable::Variable(EntityName name, std::size_t id, Type const& type, void const* constPtr, EVarFlags flags) noexcept:
 	VariableBase(new VariableImpl(name, id, type, constPtr, flags))
 {
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>	//std::size_t
+#include <iostream>
+#include <utility>	//std::forward
+
+/**
+*	Number of calls to the global operator new since the program started, counted by the replacement defined in main.cpp.
+*	Constant initialized, so allocations made during the static initialization are counted as well.
+*/
+inline std::atomic<std::size_t> allocationsCount{0u};
+
+/**
+*	@brief Run a function and print how long it took to run as well as the number of allocations it made.
+*
+*	@param name		Name of the measured code, printed with the duration.
+*	@param function	Function to run.
+*/
+template <typename Function>
+void measure(char const* name, Function&& function)
+{
+	std::size_t	startAllocationsCount	= allocationsCount.load(std::memory_order_relaxed);
+	auto		start					= std::chrono::steady_clock::now();
+
+	std::forward<Function>(function)();
+
+	auto		duration					= std::chrono::steady_clock::now() - start;
+	std::size_t	functionAllocationsCount	= allocationsCount.load(std::memory_order_relaxed) - startAllocationsCount;
+
+	std::cout << "[" << name << "] " << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << "us, " <<
+		functionAllocationsCount << " allocations" << std::endl;
+}
@@ -0,0 +1,63 @@
+#include <Refureku/Refureku.h>
+
+#include "TestCast.h"
+#include "Benchmark.h"
+
+void benchmarkDynamicCast()
+{
+	constexpr std::size_t castsCount = 1'000'000u;
+
+	GrandChild1			grandChild1;
+	Child3				child3;
+	Base* volatile		grandChild1AsBase	= &grandChild1;
+	Base2* volatile		child3AsBase2		= &child3;
+	Child1*				grandChild1AsChild1	= &grandChild1;
+	Base*				child3AsBase		= &child3;
+	std::size_t			successCount		= 0u;
+
+	//Single inheritance chain: all pointer offsets are 0
+	measure("rfk::dynamicCast, 1M single inheritance casts", [&]()
+			{
+				for (std::size_t i = 0u; i < castsCount; i++)
+				{
+					successCount += (rfk::dynamicCast<Child1>(grandChild1AsBase) == grandChild1AsChild1) ? 1u : 0u;
+				}
+			});
+
+	//Multiple inheritance: the pointer must be adjusted
+	measure("rfk::dynamicCast, 1M multiple inheritance casts", [&]()
+			{
+				for (std::size_t i = 0u; i < castsCount; i++)
+				{
+					successCount += (rfk::dynamicCast<Base>(child3AsBase2) == child3AsBase) ? 1u : 0u;
+				}
+			});
+
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+
+	measure("dynamic_cast, 1M single inheritance casts", [&]()
+			{
+				for (std::size_t i = 0u; i < castsCount; i++)
+				{
+					successCount += (dynamic_cast<Child1*>(grandChild1AsBase) == grandChild1AsChild1) ? 1u : 0u;
+				}
+			});
+
+	measure("dynamic_cast, 1M multiple inheritance casts", [&]()
+			{
+				for (std::size_t i = 0u; i < castsCount; i++)
+				{
+					successCount += (dynamic_cast<Base*>(child3AsBase2) == child3AsBase) ? 1u : 0u;
+				}
+			});
+
+	successCount /= 2u;
+
+#endif
+
+	//Use the result so that the casts are not optimized away
+	if (successCount != 2u * castsCount)
+	{
+		std::cout << "[dynamicCast] Unexpected cast results" << std::endl;
+	}
+}
@@ -0,0 +1,243 @@
+#include <string>
+#include <vector>
+#include <memory>			//std::unique_ptr
+#include <unordered_set>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>		//std::max
+
+#include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
+
+#include "Benchmark.h"
+
+void benchmarkDatabaseGetEntityById()
+{
+	constexpr std::size_t entitiesCount	= 100'000u;
+	constexpr std::size_t lookupsCount	= 1'000'000u;
+
+	struct EntityPtrIdHash
+	{
+		std::size_t operator()(rfk::Entity const* entity) const { return entity->getId(); }
+	};
+
+	struct EntityPtrIdEqual
+	{
+		bool operator()(rfk::Entity const* lhs, rfk::Entity const* rhs) const { return lhs->getId() == rhs->getId(); }
+	};
+
+	std::vector<std::unique_ptr<rfk::Enum>>						entities;
+	std::vector<std::unique_ptr<rfk::DefaultEntityRegisterer>>	registerers;
+	std::vector<std::size_t>									ids;
+
+	entities.reserve(entitiesCount);
+	registerers.reserve(entitiesCount);
+	ids.reserve(entitiesCount);
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		std::string name = "DatabaseBenchmarkEntity" + std::to_string(i);
+
+		entities.emplace_back(std::make_unique<rfk::Enum>(name.c_str(), std::hash<std::string>()(name), rfk::getArchetype<int>()));
+		registerers.emplace_back(std::make_unique<rfk::DefaultEntityRegisterer>(*entities.back()));
+		ids.push_back(entities.back()->getId());
+	}
+
+	//Node based set, equivalent to the previous database id storage
+	std::unordered_set<rfk::Entity const*, EntityPtrIdHash, EntityPtrIdEqual> nodeBasedSet;
+
+	for (std::unique_ptr<rfk::Enum> const& entity : entities)
+	{
+		nodeBasedSet.emplace(entity.get());
+	}
+
+	rfk::Database const&	database	= rfk::getDatabase();
+	std::size_t				foundCount	= 0u;
+
+	measure("Database::getEntityById, 1M lookups on 100K entities", [&]()
+			{
+				for (std::size_t i = 0u; i < lookupsCount; i++)
+				{
+					foundCount += (database.getEntityById(ids[(i * 7919u) % entitiesCount]) != nullptr) ? 1u : 0u;
+				}
+			});
+
+	measure("Node based set, 1M lookups on 100K entities", [&]()
+			{
+				for (std::size_t i = 0u; i < lookupsCount; i++)
+				{
+					foundCount += (nodeBasedSet.find(entities[(i * 7919u) % entitiesCount].get()) != nodeBasedSet.cend()) ? 1u : 0u;
+				}
+			});
+
+	//Use the result so that the lookups are not optimized away
+	if (foundCount != 2u * lookupsCount)
+	{
+		std::cout << "[Database::getEntityById] Unexpected lookup results" << std::endl;
+	}
+}
+
+/**
+*	@brief	Run reader threads looking entities up by id and by name while the provided writer runs,
+*			and print the reads throughput as well as the longest time a single read took.
+*
+*	@param name		Name of the measured scenario, printed with the results.
+*	@param ids		Ids of the registered entities to look up.
+*	@param names	Names of the registered entities to look up.
+*	@param writer	Function run by the calling thread while the readers are running.
+*/
+template <typename Writer>
+void measureConcurrentReads(char const* name, std::vector<std::size_t> const& ids, std::vector<std::string> const& names, Writer&& writer)
+{
+	std::size_t const readersCount = std::max(2u, std::thread::hardware_concurrency()) - 1u;
+
+	std::atomic<bool>			stop{false};
+	std::atomic<std::size_t>	readsCount{0u};
+	std::atomic<std::size_t>	missesCount{0u};
+	std::atomic<long long>		longestReadNs{0};
+	std::vector<std::thread>	readers;
+
+	for (std::size_t i = 0u; i < readersCount; i++)
+	{
+		readers.emplace_back([&, i]()
+							 {
+								 rfk::Database const&	database			= rfk::getDatabase();
+								 std::size_t			localReadsCount		= 0u;
+								 std::size_t			localMissesCount	= 0u;
+								 long long				localLongestReadNs	= 0;
+
+								 for (std::size_t j = i; !stop.load(std::memory_order_relaxed); j += 7919u)
+								 {
+									 auto start = std::chrono::steady_clock::now();
+
+									 localMissesCount += (database.getEntityById(ids[j % ids.size()]) == nullptr) ? 1u : 0u;
+									 localMissesCount += (database.getFileLevelEnumByName(names[j % names.size()]) == nullptr) ? 1u : 0u;
+
+									 long long readNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+									 localLongestReadNs = std::max(localLongestReadNs, readNs);
+									 localReadsCount += 2u;
+								 }
+
+								 readsCount.fetch_add(localReadsCount, std::memory_order_relaxed);
+								 missesCount.fetch_add(localMissesCount, std::memory_order_relaxed);
+
+								 long long longest = longestReadNs.load(std::memory_order_relaxed);
+
+								 while (localLongestReadNs > longest && !longestReadNs.compare_exchange_weak(longest, localLongestReadNs, std::memory_order_relaxed))
+								 {
+								 }
+							 });
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::forward<Writer>(writer)();
+
+	auto duration = std::chrono::steady_clock::now() - start;
+
+	stop.store(true, std::memory_order_relaxed);
+
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+
+	long long durationUs = std::max<long long>(1, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+
+	std::cout << "[" << name << "] " << readersCount << " readers, " << readsCount.load() << " reads in " << durationUs << "us (" <<
+		readsCount.load() * 1000u / static_cast<std::size_t>(durationUs) << " reads/ms), longest read " << longestReadNs.load() / 1000 << "us" << std::endl;
+
+	//The looked up entities stay registered during the whole benchmark
+	if (missesCount.load() != 0u)
+	{
+		std::cout << "[" << name << "] Unexpected lookup results" << std::endl;
+	}
+}
+
+void benchmarkDatabaseConcurrentReads()
+{
+	constexpr std::size_t readEntitiesCount		= 10'000u;
+	constexpr std::size_t writtenEntitiesCount	= 1'000u;
+	constexpr std::size_t writesCount			= 100u;
+
+	auto makeEntities = [](char const* prefix, std::size_t count, std::vector<std::unique_ptr<rfk::Enum>>& out_entities)
+	{
+		out_entities.reserve(count);
+
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			std::string name = prefix + std::to_string(i);
+
+			out_entities.emplace_back(std::make_unique<rfk::Enum>(name.c_str(), std::hash<std::string>()(name), rfk::getArchetype<int>()));
+		}
+	};
+
+	std::vector<std::unique_ptr<rfk::Enum>>						readEntities;
+	std::vector<std::unique_ptr<rfk::DefaultEntityRegisterer>>	readRegisterers;
+	std::vector<std::size_t>									ids;
+	std::vector<std::string>									names;
+
+	makeEntities("ConcurrentReadsBenchmarkEntity", readEntitiesCount, readEntities);
+
+	for (std::unique_ptr<rfk::Enum> const& entity : readEntities)
+	{
+		readRegisterers.emplace_back(std::make_unique<rfk::DefaultEntityRegisterer>(*entity));
+		ids.push_back(entity->getId());
+		names.emplace_back(entity->getName());
+	}
+
+	std::vector<std::unique_ptr<rfk::Enum>> writtenEntities;
+
+	makeEntities("ConcurrentWritesBenchmarkEntity", writtenEntitiesCount, writtenEntities);
+
+	//Simulate module loads / unloads, registering entities one by one or in a single batch
+	auto registerAndUnregister = [&writtenEntities](bool useBatch)
+	{
+		std::vector<std::unique_ptr<rfk::DefaultEntityRegisterer>> registerers;
+
+		registerers.reserve(writtenEntities.size());
+
+		for (std::size_t i = 0u; i < writesCount; i++)
+		{
+			if (useBatch)
+			{
+				rfk::Database::beginRegistrationBatch();
+			}
+
+			for (std::unique_ptr<rfk::Enum> const& entity : writtenEntities)
+			{
+				registerers.emplace_back(std::make_unique<rfk::DefaultEntityRegisterer>(*entity));
+			}
+
+			if (useBatch)
+			{
+				rfk::Database::endRegistrationBatch();
+				rfk::Database::beginRegistrationBatch();
+			}
+
+			registerers.clear();
+
+			if (useBatch)
+			{
+				rfk::Database::endRegistrationBatch();
+			}
+		}
+	};
+
+	measureConcurrentReads("Database, concurrent reads without writer", ids, names, []()
+						   {
+							   std::this_thread::sleep_for(std::chrono::milliseconds(200));
+						   });
+
+	measureConcurrentReads("Database, concurrent reads with a writer registering entities one by one", ids, names, [&]()
+						   {
+							   registerAndUnregister(false);
+						   });
+
+	measureConcurrentReads("Database, concurrent reads with a writer registering batches", ids, names, [&]()
+						   {
+							   registerAndUnregister(true);
+						   });
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include <vector>
+
+#include <Refureku/Refureku.h>
+
+#include "TestMethods.h"
+#include "Benchmark.h"
+
+void benchmarkMethodInvokeBatch()
+{
+	constexpr std::size_t instancesCount	= 10'000u;
+	constexpr std::size_t batchesCount		= 100u;
+
+	std::vector<BatchCallDerivedClass>	instances(instancesCount);
+	std::vector<BatchCallBaseClass*>	callers;
+	rfk::Method const*					method = BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate");
+
+	callers.reserve(instancesCount);
+
+	for (BatchCallDerivedClass& instance : instances)
+	{
+		callers.push_back(&instance);
+	}
+
+	//All 3 loops perform the same virtual accumulate(1) call on the same callers
+	measure("rfk::Method::checkedInvoke, 100x10K virtual calls", [&]()
+			{
+				for (std::size_t i = 0u; i < batchesCount; i++)
+				{
+					for (BatchCallBaseClass* caller : callers)
+					{
+						method->checkedInvoke<void, BatchCallBaseClass, int>(*caller, 1);
+					}
+				}
+			});
+
+	measure("rfk::Method::invokeBatch, 100x10K virtual calls", [&]()
+			{
+				for (std::size_t i = 0u; i < batchesCount; i++)
+				{
+					method->invokeBatch<void, BatchCallBaseClass, int>(callers.data(), callers.size(), 1);
+				}
+			});
+
+	//Plain loop over a member function pointer, which is the lower bound of what invokeBatch can achieve
+	void (BatchCallBaseClass::* volatile memberFunctionPointer)(int) = &BatchCallBaseClass::accumulate;
+	void (BatchCallBaseClass::* memberFunction)(int) = memberFunctionPointer;
+
+	measure("member function pointer loop, 100x10K virtual calls", [&]()
+			{
+				for (std::size_t i = 0u; i < batchesCount; i++)
+				{
+					for (BatchCallBaseClass* caller : callers)
+					{
+						(caller->*memberFunction)(1);
+					}
+				}
+			});
+
+	//Use the result so that the calls are not optimized away
+	for (BatchCallDerivedClass const& instance : instances)
+	{
+		if (instance.accumulated != static_cast<int>(6u * batchesCount))
+		{
+			std::cout << "[invokeBatch] Unexpected call results" << std::endl;
+			break;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <vector>
+#include <utility>	//std::index_sequence
+
+#include <Refureku/Refureku.h>
+
+#include "TestClass.h"
+#include "Benchmark.h"
+
+void benchmarkTypeFill()
+{
+	constexpr std::size_t typesCount = 100'000u;
+
+	bool isLastTypeValid = false;
+
+	measure("rfk::Type, 100K types filled and destroyed", [&]()
+			{
+				std::vector<rfk::Type> types(typesCount);
+
+				for (rfk::Type& type : types)
+				{
+					type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+					type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+					type.setArchetype(&TestClass::staticGetArchetype());
+					type.optimizeMemory();
+				}
+
+				isLastTypeValid = (types.back() == rfk::getType<TestClass*>());
+			});
+
+	//Use the result so that the types are not optimized away
+	if (!isLastTypeValid)
+	{
+		std::cout << "[Type] Unexpected filled type" << std::endl;
+	}
+}
+
+template <std::size_t Index>
+struct TypeBenchmarkTag
+{
+};
+
+template <std::size_t... Indices>
+bool getTypesFirstUse(std::index_sequence<Indices...>)
+{
+	//Value, pointer and const reference of each tag, which is how fields, parameters and return types are reflected
+	return ((rfk::getType<TypeBenchmarkTag<Indices>>().getTypePartsCount() +
+			 rfk::getType<TypeBenchmarkTag<Indices>*>().getTypePartsCount() +
+			 rfk::getType<TypeBenchmarkTag<Indices> const&>().getTypePartsCount() == 5u) && ...);
+}
+
+void benchmarkTypeFirstUse()
+{
+	constexpr std::size_t tagsCount = 500u;
+
+	bool areTypesValid = false;
+
+	//Each getType<T> instantiation fills and interns its type on first use, like the generated code does when a module is registered
+	measure("rfk::getType, 1500 types first use", [&]()
+			{
+				areTypesValid = getTypesFirstUse(std::make_index_sequence<tagsCount>());
+			});
+
+	measure("rfk::getType, 1500 types second use", [&]()
+			{
+				areTypesValid &= getTypesFirstUse(std::make_index_sequence<tagsCount>());
+			});
+
+	//Use the result so that the types are not optimized away
+	if (!areTypesValid)
+	{
+		std::cout << "[Type] Unexpected type parts count" << std::endl;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include <cstdlib>	//std::malloc, std::free
+#include <new>		//std::bad_alloc
+
+#include <Refureku/Refureku.h>
+
+__RFK_DISABLE_WARNING_PUSH
+__RFK_DISABLE_WARNING_UNUSED_RESULT
+
+#include "DatabaseBenchmarks.cpp"
+#include "CastBenchmarks.cpp"
+#include "MethodBenchmarks.cpp"
+#include "TypeBenchmarks.cpp"
+
+__RFK_DISABLE_WARNING_POP
+
+/**
+*	Replace the global operator new to count the allocations of the program.
+*	The replacement also applies to the Refureku shared library, except on Windows where each DLL keeps its own allocator.
+*	Array and nothrow variants forward to these by default.
+*/
+void* operator new(std::size_t size)
+{
+	allocationsCount.fetch_add(1u, std::memory_order_relaxed);
+
+	if (void* ptr = std::malloc(size != 0u ? size : 1u))
+	{
+		return ptr;
+	}
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+int main()
+{
+	//The reflected test types are registered before main is entered, as a dynamically loaded module would be
+	std::cout << "[Static initialization, generated test module registration] " << allocationsCount.load() << " allocations" << std::endl;
+
+	benchmarkDatabaseGetEntityById();
+	benchmarkDatabaseConcurrentReads();
+	benchmarkDynamicCast();
+	benchmarkMethodInvokeBatch();
+	benchmarkTypeFill();
+	benchmarkTypeFirstUse();
+
+	return 0;
+}
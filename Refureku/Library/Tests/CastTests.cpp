@@ -98,6 +98,42 @@ TEST(Rfk_dynamicCast_Target_Source, SuccessfulDynamicCastWithMultipleInheritance
 }
 
 
+TEST(Rfk_dynamicCast_Target_Source, NullptrCast)
+{
+	Base* nullBase = nullptr;
+
+	EXPECT_EQ(rfk::dynamicCast<Child1>(nullBase), nullptr);
+}
+
+TEST(Rfk_dynamicCast_Target_Source, CachedCastWithDifferentDynamicArchetypes)
+{
+	GrandChild1	grandChild1;
+	Child2		child2;
+	Child3		child3;
+
+	Base* instances[] = { &grandChild1, &child2, &child3 };
+	Child1* expected[] = { &grandChild1, nullptr, &child3 };
+
+	//Cast the same instances several times in a row and alternately to check both cache hits and misses
+	for (std::size_t i = 0u; i < 4u; i++)
+	{
+		for (std::size_t j = 0u; j < 3u; j++)
+		{
+			EXPECT_EQ(rfk::dynamicCast<Child1>(instances[j]), expected[j]);
+			EXPECT_EQ(rfk::dynamicCast<Child1>(instances[j]), expected[j]);
+		}
+	}
+
+	//Same dynamic archetype but different instances
+	Child3 otherChild3;
+	Base2* child3AsBase2 = &child3;
+	Base2* otherChild3AsBase2 = &otherChild3;
+
+	EXPECT_EQ(rfk::dynamicCast<Base>(child3AsBase2), static_cast<Base*>(&child3));
+	EXPECT_EQ(rfk::dynamicCast<Base>(otherChild3AsBase2), static_cast<Base*>(&otherChild3));
+	EXPECT_EQ(rfk::dynamicCast<Child3>(otherChild3AsBase2), &otherChild3);
+}
+
 TEST(Rfk_dynamicCast_Target_Source, CastInstanceWithoutGetArchetype)
 {
 	//NotObjectChild1 child1;
@@ -264,4 +300,45 @@ TEST(Rfk_dynamicDownCast_Target, FailedDownCastBecauseUpCast)
 	GrandChild1 grandChild1;
 
 	EXPECT_EQ(rfk::dynamicDownCast<void>(&grandChild1, GrandChild1::staticGetArchetype(), Base::staticGetArchetype()), nullptr);
+}
+
+//=========================================================
+//======== rfk::Struct::hasZeroPointerOffsetParents =======
+//=========================================================
+
+TEST(Rfk_Struct_hasZeroPointerOffsetParents, SingleInheritance)
+{
+	EXPECT_TRUE(Base::staticGetArchetype().hasZeroPointerOffsetParents());
+	EXPECT_TRUE(Child1::staticGetArchetype().hasZeroPointerOffsetParents());
+	EXPECT_TRUE(GrandChild1::staticGetArchetype().hasZeroPointerOffsetParents());
+}
+
+TEST(Rfk_Struct_hasZeroPointerOffsetParents, MultipleInheritance)
+{
+	EXPECT_FALSE(Child3::staticGetArchetype().hasZeroPointerOffsetParents());
+	EXPECT_FALSE(Child4::staticGetArchetype().hasZeroPointerOffsetParents());
+}
+
+TEST(Rfk_Struct_hasZeroPointerOffsetParents, NonZeroPointerOffset)
+{
+	rfk::Struct parent("Parent", 1u, 8u, false);
+	rfk::Struct child("Child", 2u, 16u, false);
+
+	child.addDirectParent(&parent, rfk::EAccessSpecifier::Public);
+	parent.addSubclass(child, 0);
+
+	EXPECT_TRUE(child.hasZeroPointerOffsetParents());
+
+	//A subclass which is not located at offset 0 of its parent
+	rfk::Struct child2("Child2", 3u, 16u, false);
+
+	child2.addDirectParent(&parent, rfk::EAccessSpecifier::Public);
+	parent.addSubclass(child2, 8);
+
+	EXPECT_FALSE(child2.hasZeroPointerOffsetParents());
+
+	int instance = 0;
+
+	EXPECT_EQ(rfk::dynamicUpCast<void>(&instance, child2, parent), reinterpret_cast<char*>(&instance) + 8);
+	EXPECT_EQ(rfk::dynamicUpCast<void>(&instance, child, parent), &instance);
 }
\ No newline at end of file
@@ -308,6 +308,47 @@ TEST(Rfk_ClassTemplate_getTemplateInstantiation, NonExistingMixedTemplateInstant
 	EXPECT_EQ(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
 }
 
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, WildcardTemplateInstantiation)
+{
+	rfk::TypeTemplateArgument arg1(rfk::getType<int>());
+	rfk::TypeTemplateArgument arg2(rfk::getType<float>());
+	rfk::TypeTemplateArgument arg3(rfk::getType<double>());
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ &arg1, &arg2, &arg3 };
+	std::vector<rfk::TemplateArgument const*> wildcardTemplateArgs{ nullptr, &arg2, nullptr };
+
+	rfk::ClassTemplateInstantiation const* instantiation = multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size());
+
+	EXPECT_NE(instantiation, nullptr);
+	EXPECT_EQ(multTypeClass->getTemplateInstantiation(wildcardTemplateArgs.data(), wildcardTemplateArgs.size()), instantiation);
+}
+
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, NonExistingWildcardTemplateInstantiation)
+{
+	rfk::TypeTemplateArgument arg1(rfk::getType<long double>());
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ &arg1, nullptr, nullptr };
+
+	EXPECT_EQ(multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, WildcardMixedTemplateInstantiation)
+{
+	constexpr std::size_t const arg2Value = 2u;
+	rfk::NonTypeTemplateArgument arg2(arg2Value);
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ nullptr, &arg2, nullptr };
+
+	EXPECT_NE(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, OnlyWildcardsTemplateInstantiation)
+{
+	std::vector<rfk::TemplateArgument const*> templateArgs{ nullptr, nullptr, nullptr };
+
+	EXPECT_NE(multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
 //=========================================================
 //===== ClassTemplate::getTemplateInstantiationsCount =====
 //=========================================================
@@ -1,9 +1,22 @@
 #include <stdexcept>	//std::logic_error
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>			//std::unique_ptr
+#include <thread>
+#include <atomic>
+#include <cstring>			//std::strncmp
+#include <unordered_set>
+#include <algorithm>		//std::find
+
+#include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
 
 #include "TestStruct.h"
+#include "TestClass.h"
+#include "TestClass2.h"
 #include "TestEnum.h"
 #include "TestNamespace.h"
 #include "TypeTemplateClassTemplate.h"
@@ -153,6 +166,194 @@ TEST(Rfk_Database_getEntityById, StaticField)
 	EXPECT_NE(rfk::getDatabase().getEntityById(FileLevelClass::staticGetArchetype().getStaticFieldByName("_staticField")->getId()), nullptr);
 }
 
+TEST(Rfk_Database_getEntityById, ManyRegisteredEntities)
+{
+	constexpr std::size_t entitiesCount = 100000u;
+
+	std::vector<std::unique_ptr<rfk::Enum>>						entities;
+	std::vector<std::unique_ptr<rfk::DefaultEntityRegisterer>>	registerers;
+	std::vector<std::size_t>									ids;
+
+	entities.reserve(entitiesCount);
+	registerers.reserve(entitiesCount);
+	ids.reserve(entitiesCount);
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		std::string name = "ManyRegisteredEntities" + std::to_string(i);
+
+		entities.emplace_back(std::make_unique<rfk::Enum>(name.c_str(), std::hash<std::string>()(name), rfk::getArchetype<int>()));
+		registerers.emplace_back(std::make_unique<rfk::DefaultEntityRegisterer>(*entities.back()));
+		ids.push_back(entities.back()->getId());
+	}
+
+	rfk::Database const& database = rfk::getDatabase();
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		EXPECT_EQ(database.getEntityById(ids[i]), entities[i].get());
+	}
+
+	//Unregister half of the entities and make sure the remaining ones are still found
+	for (std::size_t i = 0u; i < entitiesCount; i += 2u)
+	{
+		registerers[i].reset();
+	}
+
+	for (std::size_t i = 0u; i < entitiesCount; i++)
+	{
+		EXPECT_EQ(database.getEntityById(ids[i]), (i % 2u == 0u) ? nullptr : entities[i].get());
+	}
+}
+
+//=========================================================
+//=========== Database::getEntityByQualifiedName ==========
+//=========================================================
+
+TEST(Rfk_Database_getEntityByQualifiedName, FileLevelEntity)
+{
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace"), rfk::getDatabase().getNamespaceByName("filelevel_namespace"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass"), &FileLevelClass::staticGetArchetype());
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelEnum"), rfk::getEnum<FileLevelEnum>());
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("fileLevelVar"), rfk::getDatabase().getFileLevelVariableByName("fileLevelVar"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("fileLevelFunc"), rfk::getDatabase().getFileLevelFunctionByName("fileLevelFunc"));
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, NestedEntity)
+{
+	rfk::Namespace const* n = rfk::getDatabase().getNamespaceByName("filelevel_namespace");
+
+	ASSERT_NE(n, nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::nested_namespace"), n->getNamespaceByName("nested_namespace"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::NamespaceClass"), &filelevel_namespace::NamespaceClass::staticGetArchetype());
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::NamespaceEnum"), rfk::getEnum<filelevel_namespace::NamespaceEnum>());
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::namespaceVar"), n->getVariableByName("namespaceVar"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::namespaceFunc"), n->getFunctionByName("namespaceFunc"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::ClassClass"), &FileLevelClass::ClassClass::staticGetArchetype());
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::ClassEnum"), rfk::getEnum<FileLevelClass::ClassEnum>());
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, EnumValue)
+{
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelEnum::Value1"), rfk::getEnum<FileLevelEnum>()->getEnumValueByName("Value1"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::ClassEnum::Value1"), rfk::getEnum<FileLevelClass::ClassEnum>()->getEnumValueByName("Value1"));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelEnum::Value3"), nullptr);
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, StructMember)
+{
+	rfk::Struct const& c = FileLevelClass::staticGetArchetype();
+
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::_field"), c.getFieldByName("_field", rfk::EFieldFlags::Default));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::_staticField"), c.getStaticFieldByName("_staticField", rfk::EFieldFlags::Default));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::method"), c.getMethodByName("method", rfk::EMethodFlags::Default));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::staticMethod"), c.getStaticMethodByName("staticMethod", rfk::EMethodFlags::Default));
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::_field::_field"), nullptr);
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, NonExistingEntity)
+{
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName(""), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("nested_namespace"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("filelevel_namespace::ClassClass"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("fileLevelVar::fileLevelVar"), nullptr);
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, IllFormedName)
+{
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("::FileLevelClass"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass:ClassClass"), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName("FileLevelClass::::ClassClass"), nullptr);
+}
+
+TEST(Rfk_Database_getEntityByQualifiedName, NonNullTerminatedName)
+{
+	std::string_view qualifiedName = "FileLevelClass::ClassClass::Suffix";
+
+	EXPECT_EQ(rfk::getDatabase().getEntityByQualifiedName(qualifiedName.substr(0u, qualifiedName.size() - 8u)), &FileLevelClass::ClassClass::staticGetArchetype());
+}
+
+//=========================================================
+//=========== Database::getEntitiesWithProperty ===========
+//=========================================================
+
+TEST(Rfk_Database_getEntitiesWithProperty, WithChildClasses)
+{
+	rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<UniqueInheritedProperty>(true);
+
+	std::unordered_set<rfk::Entity const*> entitiesSet(entities.cbegin(), entities.cend());
+
+	EXPECT_EQ(entitiesSet.size(), entities.size());	//No duplicate
+	EXPECT_EQ(entitiesSet.count(&TestClass::staticGetArchetype()), 1u);
+	EXPECT_EQ(entitiesSet.count(&TestClass2::staticGetArchetype()), 1u);	//UniqueInheritedPropertyChild
+	EXPECT_EQ(entitiesSet.count(&TestClass3::staticGetArchetype()), 1u);
+	EXPECT_EQ(entitiesSet.count(&test_namespace::TestNamespaceNestedStruct::staticGetArchetype()), 0u);
+
+	for (rfk::Entity const* entity : entities)
+	{
+		EXPECT_TRUE(entity->hasProperty<UniqueInheritedProperty>(true));
+	}
+}
+
+TEST(Rfk_Database_getEntitiesWithProperty, WithoutChildClasses)
+{
+	rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<MultipleInheritedProperty>(false);
+
+	std::unordered_set<rfk::Entity const*> entitiesSet(entities.cbegin(), entities.cend());
+
+	EXPECT_EQ(entitiesSet.count(&TestClass::staticGetArchetype()), 1u);
+	EXPECT_EQ(entitiesSet.count(&TestClass3::staticGetArchetype()), 1u);	//MultipleInheritedProperty(4) inherited from TestClass
+
+	for (rfk::Entity const* entity : entities)
+	{
+		EXPECT_TRUE(entity->hasProperty<MultipleInheritedProperty>(false));
+	}
+
+	EXPECT_LE(entities.size(), rfk::getDatabase().getEntitiesWithProperty<MultipleInheritedProperty>(true).size());
+}
+
+TEST(Rfk_Database_getEntitiesWithProperty, NoEntity)
+{
+	//TestClass is not a property so it can't be attached to any entity
+	EXPECT_TRUE(rfk::getDatabase().getEntitiesWithProperty(TestClass::staticGetArchetype()).empty());
+}
+
+TEST(Rfk_Database_getEntitiesWithProperty, DoubleRegistration)
+{
+	UniqueInheritedProperty property(42);
+
+	rfk::Enum registered("DoubleRegistrationEnum", 424242u, rfk::getArchetype<int>());
+	rfk::Enum duplicate("DoubleRegistrationEnum", 424242u, rfk::getArchetype<int>());
+
+	registered.addProperty(property);
+	duplicate.addProperty(property);
+
+	{
+		rfk::DefaultEntityRegisterer registeredRegisterer(registered);
+
+		{
+			//The duplicate is rejected, so its properties must not be indexed
+			rfk::DefaultEntityRegisterer duplicateRegisterer(duplicate);
+
+			rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<UniqueInheritedProperty>(false);
+
+			EXPECT_NE(std::find(entities.cbegin(), entities.cend(), &registered), entities.cend());
+			EXPECT_EQ(std::find(entities.cbegin(), entities.cend(), &duplicate), entities.cend());
+		}
+
+		//Unregistering the duplicate must not unregister the registered entity nor its properties
+		rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<UniqueInheritedProperty>(false);
+
+		EXPECT_NE(std::find(entities.cbegin(), entities.cend(), &registered), entities.cend());
+		EXPECT_EQ(rfk::getDatabase().getEntityById(424242u), &registered);
+	}
+
+	rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<UniqueInheritedProperty>(false);
+
+	EXPECT_EQ(std::find(entities.cbegin(), entities.cend(), &registered), entities.cend());
+}
+
 //=========================================================
 //============= Database::getNamespaceById ================
 //=========================================================
@@ -197,6 +398,15 @@ TEST(Rfk_Database_getNamespaceByName, NonNamespaceEntity)
 	EXPECT_EQ(rfk::getDatabase().getNamespaceByName("FileLevelEnum"), nullptr);
 }
 
+TEST(Rfk_Database_getNamespaceByName, StringView)
+{
+	std::string_view name = "filelevel_namespace::nested_namespace::";
+
+	EXPECT_NE(rfk::getDatabase().getNamespaceByName(name.substr(0u, name.size() - 2u)), nullptr);
+	EXPECT_EQ(rfk::getDatabase().getNamespaceByName(name.substr(0u, 17u)), nullptr);
+	EXPECT_THROW(rfk::getDatabase().getNamespaceByName(name), rfk::BadNamespaceFormat);
+}
+
 //=========================================================
 //====== Database::getFileLevelNamespaceByPredicate =======
 //=========================================================
@@ -646,6 +856,14 @@ TEST(Rfk_Database_getClassByName, NonClassEntity)
 	EXPECT_EQ(rfk::getDatabase().getFileLevelClassByName("fileLevelFunc"), nullptr);
 }
 
+TEST(Rfk_Database_getClassByName, StringView)
+{
+	std::string_view name = "FileLevelClass3";
+
+	EXPECT_EQ(rfk::getDatabase().getFileLevelClassByName(name.substr(0u, name.size() - 1u)), &FileLevelClass::staticGetArchetype());
+	EXPECT_EQ(rfk::getDatabase().getFileLevelClassByName(std::string("FileLevelClass2")), rfk::getDatabase().getFileLevelClassByName("FileLevelClass2"));
+}
+
 //=========================================================
 //======== Database::getFileLevelClassByPredicate ========
 //=========================================================
@@ -1410,4 +1628,94 @@ TEST(Rfk_Database_getEnumValueById, NonEnumValueEntityId)
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticFieldByName("_staticField")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getMethodByName("method")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticMethodByName("staticMethod")->getId()), nullptr);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//===== Database::beginRegistrationBatch / endRegistrationBatch =====
+//=========================================================
+
+TEST(Rfk_Database_registrationBatch, ConcurrentReadersAndWriter)
+{
+	constexpr std::size_t	readersCount	= 4u;
+	constexpr std::size_t	batchSize		= 256u;
+	constexpr std::size_t	batchesCount	= 50u;
+	constexpr char const*	namePrefix		= "RegistrationBatchEntity";
+
+	std::atomic<bool>			stop{false};
+	std::atomic<std::size_t>	tornBatchesCount{0u};
+	std::vector<std::thread>	readers;
+
+	for (std::size_t i = 0u; i < readersCount; i++)
+	{
+		readers.emplace_back([&]()
+							 {
+								 while (!stop.load(std::memory_order_relaxed))
+								 {
+									 //A batch must either be completely visible or not visible at all
+									 std::size_t batchEntitiesCount = 0u;
+
+									 rfk::getDatabase().foreachFileLevelEnum([](rfk::Enum const& e, void* userData)
+																			 {
+																				 if (std::strncmp(e.getName(), namePrefix, std::strlen(namePrefix)) == 0)
+																				 {
+																					 (*reinterpret_cast<std::size_t*>(userData))++;
+																				 }
+
+																				 return true;
+																			 }, &batchEntitiesCount);
+
+									 if (batchEntitiesCount != 0u && batchEntitiesCount != batchSize)
+									 {
+										 tornBatchesCount.fetch_add(1u, std::memory_order_relaxed);
+									 }
+
+									 (void)rfk::getDatabase().getFileLevelEnumByName("RegistrationBatchEntity0");
+									 (void)rfk::getDatabase().getFileLevelClassByName("FileLevelClass");
+								 }
+							 });
+	}
+
+	for (std::size_t batch = 0u; batch < batchesCount; batch++)
+	{
+		std::vector<std::unique_ptr<rfk::Enum>>						entities;
+		std::vector<std::unique_ptr<rfk::DefaultEntityRegisterer>>	registerers;
+
+		entities.reserve(batchSize);
+		registerers.reserve(batchSize);
+
+		for (std::size_t i = 0u; i < batchSize; i++)
+		{
+			std::string name = namePrefix + std::to_string(i);
+
+			entities.emplace_back(std::make_unique<rfk::Enum>(name.c_str(), std::hash<std::string>()(name), rfk::getArchetype<int>()));
+		}
+
+		//Simulate a module load
+		rfk::Database::beginRegistrationBatch();
+
+		for (std::unique_ptr<rfk::Enum> const& entity : entities)
+		{
+			registerers.emplace_back(std::make_unique<rfk::DefaultEntityRegisterer>(*entity));
+		}
+
+		rfk::Database::endRegistrationBatch();
+
+		EXPECT_EQ(rfk::getDatabase().getEntityById(entities.back()->getId()), entities.back().get());
+
+		//Simulate a module unload
+		rfk::Database::beginRegistrationBatch();
+		registerers.clear();
+		rfk::Database::endRegistrationBatch();
+
+		EXPECT_EQ(rfk::getDatabase().getEntityById(entities.back()->getId()), nullptr);
+	}
+
+	stop.store(true, std::memory_order_relaxed);
+
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+
+	EXPECT_EQ(tornBatchesCount.load(), 0u);
+}
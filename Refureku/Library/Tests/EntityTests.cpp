@@ -1,3 +1,4 @@
+#include <string>
 #include <string_view>
 #include <stdexcept>	//std::logic-error
 
@@ -79,13 +80,104 @@ TEST(Rfk_Entity_getName, EnumValue)
 	EXPECT_STREQ(rfk::getEnum<TestEnumClass>()->getEnumValueByName("Value3")->getName(), "Value3");
 }
 
+TEST(Rfk_Entity_getName, StaticName)
+{
+	static constexpr char name[] = "StaticNameStruct";
+
+	rfk::Struct s(rfk::EntityName::fromLiteral(name), 0u, 1u, false);
+
+	//Static names are referenced, not copied
+	EXPECT_EQ(s.getName(), name);
+	EXPECT_EQ(s.getNameHash(), std::hash<std::string_view>()("StaticNameStruct"));
+}
+
+TEST(Rfk_Entity_getName, DynamicName)
+{
+	std::string name = "DynamicNameStructWithALongName";
+
+	rfk::Struct s(name.c_str(), 0u, 1u, false);
+
+	//Dynamic names are copied, so they don't depend on the provided string lifetime
+	EXPECT_NE(s.getName(), name.c_str());
+	name.assign(name.size(), 'x');
+
+	EXPECT_STREQ(s.getName(), "DynamicNameStructWithALongName");
+	EXPECT_EQ(s.getNameHash(), std::hash<std::string_view>()("DynamicNameStructWithALongName"));
+
+	rfk::Field* field = s.addField(std::string("dynamicField").c_str(), 0u, rfk::getType<int>(), rfk::EFieldFlags::Public, 0u, &s);
+	EXPECT_STREQ(field->getName(), "dynamicField");
+	EXPECT_EQ(s.getFieldByName("dynamicField"), field);
+}
+
+TEST(Rfk_Entity_getName, EntityName)
+{
+	constexpr rfk::EntityName staticName = rfk::EntityName::fromLiteral("Name");
+
+	static_assert(staticName.isStatic());
+	static_assert(staticName.getLength() == 4u);
+
+	//Arrays which are not a plain string literal are copied up to their first null terminator
+	static constexpr char buffer[16] = "Name";
+	constexpr rfk::EntityName bufferName = rfk::EntityName::fromLiteral(buffer);
+
+	static_assert(!bufferName.isStatic());
+	static_assert(bufferName.getLength() == 4u);
+
+	constexpr rfk::EntityName embeddedNullName = rfk::EntityName::fromLiteral("Na\0me");
+
+	static_assert(!embeddedNullName.isStatic());
+	static_assert(embeddedNullName.getLength() == 2u);
+
+	rfk::EntityName dynamicName("Name");
+
+	EXPECT_FALSE(dynamicName.isStatic());
+	EXPECT_EQ(dynamicName.getLength(), 4u);
+	EXPECT_EQ(rfk::EntityName(nullptr).getData(), nullptr);
+}
+
+//=========================================================
+//================ Entity::getNameHash ====================
+//=========================================================
+
+TEST(Rfk_Entity_getNameHash, MatchesNameHash)
+{
+	EXPECT_EQ(rfk::getArchetype<TestClass>()->getNameHash(), std::hash<std::string_view>()("TestClass"));
+	EXPECT_EQ(TestClass::staticGetArchetype().getNestedClassByName("NestedClass")->getNameHash(), std::hash<std::string_view>()("NestedClass"));
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getNameHash(), std::hash<std::string_view>()(rfk::getEnum<TestEnum>()->getName()));
+}
+
 //=========================================================
 //================== Entity::getId ========================
 //=========================================================
 
 TEST(Rfk_Entity_getId, getId)
 {
-	EXPECT_EQ(rfk::getArchetype<void>()->getId(), std::hash<std::string_view>()("void"));
+	EXPECT_EQ(rfk::getArchetype<void>()->getId(), rfk::computeEntityIdHash("void"));
+}
+
+TEST(Rfk_Entity_getId, computeEntityIdHash)
+{
+	//Entity ids must be the same on every platform
+	static_assert(rfk::computeEntityIdHash("") == 14695981039346656037ull);
+	static_assert(rfk::computeEntityIdHash("a") == 0xaf63dc4c8601ec8cull);
+	static_assert(rfk::computeEntityIdHash("foobar") == 0x85944171f73967e8ull);
+
+	//Hashing the concatenation of 2 strings is the same as chaining their hashes
+	EXPECT_EQ(rfk::computeEntityIdHash("c:@S@Foo>#I"), rfk::computeEntityIdHash(">#I", rfk::computeEntityIdHash("c:@S@Foo")));
+}
+
+TEST(Rfk_Entity_getId, typeNestedEntityId)
+{
+	constexpr rfk::uint64 entityIdHash = rfk::computeEntityIdHash("c:@ST>1#T@Vector@F@size");
+
+	//Usable in constant expressions
+	static_assert(rfk::internal::typeNestedEntityId<int, entityIdHash> != rfk::internal::typeNestedEntityId<float, entityIdHash>);
+
+	//The id hashes the canonical name of the type, which doesn't depend on the compiler
+	static_assert(rfk::internal::typeNestedEntityId<int, entityIdHash> == rfk::computeEntityIdHash("c:@ST>1#T@Vector@F@sizeint"));
+	static_assert(rfk::internal::typeNestedEntityId<unsigned int const*&, entityIdHash> == rfk::computeEntityIdHash("unsigned int const*&", entityIdHash));
+	static_assert(rfk::internal::typeNestedEntityId<TestClass, entityIdHash> == rfk::computeEntityIdHash("TestClass", entityIdHash));
+	static_assert(rfk::internal::typeNestedEntityId<SingleTypeTemplateClassTemplate<TestClass*>, entityIdHash> == rfk::computeEntityIdHash("SingleTypeTemplateClassTemplate<TestClass*>", entityIdHash));
 }
 
 //=========================================================
@@ -316,6 +408,62 @@ TEST(Rfk_Entity_getPropertyTemplate, WithoutChildClasses)
 	EXPECT_EQ(TestClass::staticGetArchetype().getProperty<kodgen::ParseAllNested>(false), nullptr);		//Not found
 }
 
+TEST(Rfk_Entity_getProperty, ReloadedArchetype)
+{
+	struct ManualProperty : rfk::Property
+	{
+		rfk::Struct const* archetype;
+
+		ManualProperty(rfk::Struct const& archetype_) noexcept: archetype{&archetype_} {}
+
+		rfk::Struct const& getArchetype() const noexcept override { return *archetype; }
+	};
+
+	//An archetype reloaded with the same id (module reload) must work like the first one
+	for (int i = 0; i < 3; i++)
+	{
+		rfk::Struct		archetype("ReloadedPropertyArchetype", 4242u, sizeof(ManualProperty), false);
+		rfk::Struct		entity("ReloadedPropertyOwner", 0u, 1u, false);
+		ManualProperty	property(archetype);
+
+		EXPECT_FALSE(entity.hasProperty(archetype));
+		EXPECT_TRUE(entity.addProperty(property));
+		EXPECT_EQ(entity.getProperty(archetype), &property);
+	}
+}
+
+//=========================================================
+//================== Entity::hasProperty ==================
+//=========================================================
+
+TEST(Rfk_Entity_hasProperty, WithChildClasses)
+{
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty<UniqueInheritedProperty>(true));
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty<MultipleInheritedProperty>(true));
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty(MultipleInheritedProperty::staticGetArchetype(), true));
+	EXPECT_FALSE(TestClass::staticGetArchetype().hasProperty<kodgen::ParseAllNested>(true));
+	EXPECT_FALSE(test_namespace::TestNamespaceNestedStruct::staticGetArchetype().hasProperty<UniqueInheritedProperty>(true));
+}
+
+TEST(Rfk_Entity_hasProperty, WithoutChildClasses)
+{
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty<UniqueInheritedProperty>(false));
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty<MultipleInheritedPropertyChild>(false));
+	EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty(MultipleInheritedProperty::staticGetArchetype(), false));
+	EXPECT_FALSE(TestClass::staticGetArchetype().hasProperty<kodgen::ParseAllNested>(false));
+}
+
+TEST(Rfk_Entity_hasProperty, MatchesGetProperty)
+{
+	for (std::size_t i = 0u; i < TestClass::staticGetArchetype().getPropertiesCount(); i++)
+	{
+		rfk::Struct const& archetype = TestClass::staticGetArchetype().getPropertyAt(i)->getArchetype();
+
+		EXPECT_TRUE(TestClass::staticGetArchetype().hasProperty(archetype, false));
+		EXPECT_EQ(TestClass::staticGetArchetype().getProperty(archetype, false)->getArchetype(), archetype);
+	}
+}
+
 //=========================================================
 //============== Entity::getPropertyByName ================
 //=========================================================
@@ -1,13 +1,19 @@
 #include <stdexcept>	//std::logic_error
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Archetypes/EnumTable.h>
 
 #include "TestStruct.h"
 #include "TestClass.h"
 #include "TestClass2.h"
 #include "TestEnum.h"
 #include "TestNamespace.h"
+#include "TestNestedEnums.h"
 #include "TypeTemplateClassTemplate.h"
 
 //=========================================================
@@ -35,6 +41,36 @@ TEST(Rfk_Enum_getEnumValueByName, NonExistantValue)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValueByName("value1"), nullptr);	//Test case
 }
 
+TEST(Rfk_Enum_getEnumValueByName, StringView)
+{
+	std::string_view name = "TestEnumValue1Suffix";
+
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getEnumValueByName(name.substr(0u, 14u)), rfk::getEnum<TestEnum>()->getEnumValueByName("TestEnumValue1"));
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getEnumValueByName(name), nullptr);
+}
+
+TEST(Rfk_Enum_getEnumValueByName, ManyValues)
+{
+	rfk::Enum e("ManyValuesEnum", 0u, rfk::getArchetype<int>());
+	std::vector<std::string> names;
+
+	for (int i = 0; i < 300; i++)
+	{
+		names.push_back("Value" + std::to_string(i));
+		e.addEnumValue(names.back().c_str(), 0u, i * 3);
+	}
+
+	for (int i = 0; i < 300; i++)
+	{
+		rfk::EnumValue const* enumValue = e.getEnumValueByName(names[i].c_str());
+
+		ASSERT_NE(enumValue, nullptr);
+		EXPECT_EQ(enumValue->getValue(), i * 3);
+	}
+
+	EXPECT_EQ(e.getEnumValueByName("Value300"), nullptr);
+}
+
 //=========================================================
 //================= Enum::getEnumValue ====================
 //=========================================================
@@ -51,6 +87,77 @@ TEST(Rfk_Enum_getEnumValue, NonExistantValue)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValue(-1), nullptr);
 }
 
+TEST(Rfk_Enum_getEnumValue, DenseValues)
+{
+	rfk::Enum e("DenseEnum", 0u, rfk::getArchetype<int>());
+
+	//Unordered values with a hole
+	e.addEnumValue("Two", 0u, 2);
+	e.addEnumValue("MinusOne", 0u, -1);
+	e.addEnumValue("Zero", 0u, 0);
+	e.addEnumValue("Four", 0u, 4);
+
+	EXPECT_STREQ(e.getEnumValue(2)->getName(), "Two");
+	EXPECT_STREQ(e.getEnumValue(-1)->getName(), "MinusOne");
+	EXPECT_STREQ(e.getEnumValue(0)->getName(), "Zero");
+	EXPECT_STREQ(e.getEnumValue(4)->getName(), "Four");
+	EXPECT_EQ(e.getEnumValue(1), nullptr);
+	EXPECT_EQ(e.getEnumValue(3), nullptr);
+	EXPECT_EQ(e.getEnumValue(-2), nullptr);
+	EXPECT_EQ(e.getEnumValue(5), nullptr);
+}
+
+TEST(Rfk_Enum_getEnumValue, SparseValues)
+{
+	rfk::Enum e("SparseEnum", 0u, rfk::getArchetype<rfk::int64>());
+
+	e.addEnumValue("Max", 0u, std::numeric_limits<rfk::int64>::max());
+	e.addEnumValue("Flag", 0u, 1 << 10);
+	e.addEnumValue("Min", 0u, std::numeric_limits<rfk::int64>::min());
+
+	EXPECT_STREQ(e.getEnumValue(std::numeric_limits<rfk::int64>::max())->getName(), "Max");
+	EXPECT_STREQ(e.getEnumValue(std::numeric_limits<rfk::int64>::min())->getName(), "Min");
+	EXPECT_STREQ(e.getEnumValue(1 << 10)->getName(), "Flag");
+	EXPECT_EQ(e.getEnumValue(0), nullptr);
+}
+
+TEST(Rfk_Enum_getEnumValue, SharedValue)
+{
+	rfk::Enum e("SharedValueEnum", 0u, rfk::getArchetype<int>());
+
+	e.addEnumValue("One", 0u, 1);
+	e.addEnumValue("Alias", 0u, 1);
+	e.addEnumValue("Zero", 0u, 0);
+
+	//The first added enum value is returned
+	EXPECT_STREQ(e.getEnumValue(1)->getName(), "One");
+
+	rfk::Vector<rfk::EnumValue const*> values = e.getEnumValues(1);
+	ASSERT_EQ(values.size(), 2u);
+	EXPECT_STREQ(values[0]->getName(), "One");
+	EXPECT_STREQ(values[1]->getName(), "Alias");
+}
+
+TEST(Rfk_Enum_getEnumValue, AddAfterLookup)
+{
+	rfk::Enum e("AddAfterLookupEnum", 0u, rfk::getArchetype<int>());
+
+	e.addEnumValue("Zero", 0u, 0);
+	EXPECT_EQ(e.getEnumValue(1), nullptr);
+	EXPECT_EQ(e.getEnumValueByName("One"), nullptr);
+
+	//Adding values after a lookup must refresh the indices
+	for (int i = 1; i < 64; i++)
+	{
+		e.addEnumValue((i == 1) ? "One" : "Other", 0u, i);
+	}
+
+	EXPECT_STREQ(e.getEnumValue(1)->getName(), "One");
+	EXPECT_STREQ(e.getEnumValueByName("One")->getName(), "One");
+	EXPECT_STREQ(e.getEnumValue(0)->getName(), "Zero");
+	EXPECT_EQ(e.getEnumValue(63)->getValue(), 63);
+}
+
 //=========================================================
 //============ Enum::getEnumValueByPredicate ==============
 //=========================================================
@@ -238,4 +345,148 @@ TEST(Rfk_Enum_foreachEnumValue, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getEnum<TestEnumClass>()->foreachEnumValue(visitor, nullptr), std::logic_error);
+}
+
+//=========================================================
+//========== rfk::enumToString / rfk::stringToEnum ========
+//=========================================================
+
+enum class EnumTableBoolEnum : bool
+{
+	No,
+	Yes
+};
+
+enum class EnumTableSignedEnum : signed char
+{
+	Min			= -128,
+	MinusOne	= -1,
+	Zero		= 0,
+	ZeroAlias	= Zero,
+	Max			= 127
+};
+
+namespace rfk
+{
+	template <>
+	struct EnumTable<EnumTableBoolEnum>
+	{
+		static constexpr std::array<EnumTableEntry<EnumTableBoolEnum>, 2u> entries{{
+			{"No", EnumTableBoolEnum::No},
+			{"Yes", EnumTableBoolEnum::Yes}
+		}};
+	};
+
+	//Entries are purposely sorted neither by value nor by name
+	template <>
+	struct EnumTable<EnumTableSignedEnum>
+	{
+		static constexpr std::array<EnumTableEntry<EnumTableSignedEnum>, 5u> entries{{
+			{"Zero", EnumTableSignedEnum::Zero},
+			{"Max", EnumTableSignedEnum::Max},
+			{"MinusOne", EnumTableSignedEnum::MinusOne},
+			{"ZeroAlias", EnumTableSignedEnum::ZeroAlias},
+			{"Min", EnumTableSignedEnum::Min}
+		}};
+	};
+}
+
+TEST(Rfk_Enum_enumToString, ContiguousGeneratedEnum)
+{
+	static_assert(rfk::internal::EnumTableHelper<TestEnum>::hasContiguousValues);
+	static_assert(rfk::enumToString(TestEnumValue2) == "TestEnumValue2");
+
+	EXPECT_EQ(rfk::enumToString(TestEnumValue1), "TestEnumValue1");
+	EXPECT_EQ(rfk::enumToString(TestEnumValue3), "TestEnumValue3");
+	EXPECT_TRUE(rfk::enumToString(static_cast<TestEnum>(3)).empty());
+}
+
+TEST(Rfk_Enum_enumToString, SparseGeneratedEnum)
+{
+	//Sparse values are looked up with a binary search
+	static_assert(!rfk::internal::EnumTableHelper<TestEnumClass>::hasContiguousValues);
+	static_assert(rfk::enumToString(TestEnumClass::Value123) == "Value123");
+
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value1), "Value1");
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value2), "Value2");
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value123), "Value123");
+	EXPECT_TRUE(rfk::enumToString(static_cast<TestEnumClass>(0)).empty());
+	EXPECT_TRUE(rfk::enumToString(static_cast<TestEnumClass>(3)).empty());
+	EXPECT_TRUE(rfk::enumToString(static_cast<TestEnumClass>(8)).empty());
+}
+
+TEST(Rfk_Enum_enumToString, DuplicateValues)
+{
+	//Enum values sharing a value resolve to the first declared one
+	static_assert(rfk::enumToString(TestEnumClass::Value3Alias) == "Value3");
+	static_assert(rfk::enumToString(EnumTableSignedEnum::ZeroAlias) == "Zero");
+
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value3), "Value3");
+	EXPECT_EQ(rfk::enumToString(EnumTableSignedEnum::Zero), "Zero");
+}
+
+TEST(Rfk_Enum_enumToString, UnderlyingTypeRange)
+{
+	static_assert(!rfk::internal::EnumTableHelper<EnumTableSignedEnum>::hasContiguousValues);
+	static_assert(rfk::internal::EnumTableHelper<EnumTableBoolEnum>::hasContiguousValues);
+
+	EXPECT_EQ(rfk::enumToString(EnumTableSignedEnum::Min), "Min");
+	EXPECT_EQ(rfk::enumToString(EnumTableSignedEnum::MinusOne), "MinusOne");
+	EXPECT_EQ(rfk::enumToString(EnumTableSignedEnum::Max), "Max");
+	EXPECT_TRUE(rfk::enumToString(static_cast<EnumTableSignedEnum>(1)).empty());
+
+	EXPECT_EQ(rfk::enumToString(EnumTableBoolEnum::No), "No");
+	EXPECT_EQ(rfk::enumToString(EnumTableBoolEnum::Yes), "Yes");
+}
+
+TEST(Rfk_Enum_enumToString, NonPublicNestedEnum)
+{
+	static_assert(NestedEnumInspector::privateEnumNestedLvl1ToString(1) == "Value2");
+
+	EXPECT_EQ(NestedEnumInspector::privateEnumNestedLvl1ToString(0), "Value1");
+	EXPECT_TRUE(NestedEnumInspector::privateEnumNestedLvl1ToString(2).empty());
+}
+
+TEST(Rfk_Enum_stringToEnum, GeneratedEnum)
+{
+	static_assert(rfk::stringToEnum<TestEnum>("TestEnumValue3") == TestEnumValue3);
+	static_assert(rfk::stringToEnum<TestEnumClass>("Value3Alias") == TestEnumClass::Value3);
+
+	EXPECT_EQ(rfk::stringToEnum<TestEnum>("TestEnumValue1"), TestEnumValue1);
+	EXPECT_EQ(rfk::stringToEnum<TestEnumClass>("Value123"), TestEnumClass::Value123);
+	EXPECT_EQ(rfk::stringToEnum<EnumTableSignedEnum>("Min"), EnumTableSignedEnum::Min);
+	EXPECT_EQ(rfk::stringToEnum<EnumTableBoolEnum>("Yes"), EnumTableBoolEnum::Yes);
+}
+
+TEST(Rfk_Enum_stringToEnum, Miss)
+{
+	static_assert(!rfk::stringToEnum<TestEnumClass>("Value4").has_value());
+
+	EXPECT_FALSE(rfk::stringToEnum<TestEnum>("").has_value());
+	EXPECT_FALSE(rfk::stringToEnum<TestEnum>("TestEnumValue").has_value());		//Prefix of an enum value name
+	EXPECT_FALSE(rfk::stringToEnum<TestEnum>("TestEnumValue10").has_value());	//Starts with an enum value name
+	EXPECT_FALSE(rfk::stringToEnum<TestEnumClass>("value1").has_value());		//Case sensitive
+	EXPECT_FALSE(rfk::stringToEnum<TestEnumClass>("A").has_value());			//Before all names
+	EXPECT_FALSE(rfk::stringToEnum<TestEnumClass>("Z").has_value());			//After all names
+	EXPECT_FALSE(NestedEnumInspector::privateEnumNestedLvl1FromString("Value3"));
+}
+
+TEST(Rfk_Enum_stringToEnum, NonPublicNestedEnum)
+{
+	EXPECT_TRUE(NestedEnumInspector::privateEnumNestedLvl1FromString("Value1"));
+	EXPECT_TRUE(NestedEnumInspector::privateEnumNestedLvl1FromString("Value2"));
+}
+
+TEST(Rfk_Enum_enumTable, MatchesGeneratedEnum)
+{
+	rfk::Enum const* e = rfk::getEnum<TestEnumClass>();
+
+	ASSERT_EQ(rfk::EnumTable<TestEnumClass>::entries.size(), e->getEnumValuesCount());
+
+	for (std::size_t i = 0u; i < e->getEnumValuesCount(); i++)
+	{
+		//Entries are in declaration order
+		EXPECT_EQ(rfk::EnumTable<TestEnumClass>::entries[i].name, e->getEnumValueAt(i).getName());
+		EXPECT_EQ(static_cast<rfk::int64>(rfk::EnumTable<TestEnumClass>::entries[i].value), e->getEnumValueAt(i).getValue());
+	}
 }
\ No newline at end of file
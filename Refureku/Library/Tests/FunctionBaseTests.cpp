@@ -227,4 +227,28 @@ TEST(Rfk_FunctionBase_getInternalFunction, _)
 {
 	//No meant to be used by end user... but well it is possible
 	EXPECT_NE(rfk::getDatabase().getFileLevelFunctionByName("func_MultipleParams")->getInternalFunction(), nullptr);
+}
+
+//=========================================================
+//======== FunctionBase::getSignatureFingerprint ==========
+//=========================================================
+
+TEST(Rfk_FunctionBase_getSignatureFingerprint, SameSignature)
+{
+	EXPECT_EQ(rfk::getDatabase().getFileLevelFunctionByName("func_noParam")->getSignatureFingerprint(),
+			  rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->getSignatureFingerprint());
+}
+
+TEST(Rfk_FunctionBase_getSignatureFingerprint, DifferentReturnTypeSameParams)
+{
+	EXPECT_NE(rfk::getDatabase().getFileLevelFunctionByName("func_return_MultipleParams")->getSignatureFingerprint(),
+			  rfk::getDatabase().getFileLevelFunctionByName("func_MultipleParams")->getSignatureFingerprint());
+}
+
+TEST(Rfk_FunctionBase_getSignatureFingerprint, SameReturnTypeDifferentParams)
+{
+	EXPECT_NE(rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->getSignatureFingerprint(),
+			  rfk::getDatabase().getFileLevelFunctionByName("func_return_MultipleParams")->getSignatureFingerprint());
+	EXPECT_NE(rfk::getDatabase().getFileLevelFunctionByName("func_noParam")->getSignatureFingerprint(),
+			  rfk::getDatabase().getFileLevelFunctionByName("func_singleParam")->getSignatureFingerprint());
 }
\ No newline at end of file
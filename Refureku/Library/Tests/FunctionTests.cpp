@@ -152,4 +152,64 @@ TEST(Rfk_Function_checkedInvoke, NonReflectedTypeBypassArgTypeMismatch)
 TEST(Rfk_Function_checkedInvoke, ThrowingCall)
 {
 	EXPECT_THROW(rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->checkedInvoke(), std::logic_error);
+}
+
+//=========================================================
+//================ Function::invokeErased =================
+//=========================================================
+
+TEST(Rfk_Function_invokeErased, SuccessfullCall)
+{
+	int		i = 40;
+	int		j = 2;
+	void*	args[] = { &i, &j };
+	int		result = 0;
+
+	rfk::getDatabase().getFileLevelFunctionByName("func_return_MultipleParams")->invokeErased(args, &result);
+
+	EXPECT_EQ(result, 42);
+}
+
+TEST(Rfk_Function_invokeErased, ReferenceParameter)
+{
+	NonReflectedClass	nrc;
+	int					value = 42;
+	void*				args[] = { &nrc, &value };
+
+	rfk::getDatabase().getFileLevelFunctionByName("func_twoParamsNonReflected")->invokeErased(args, nullptr);
+
+	EXPECT_EQ(nrc.i, 42);
+}
+
+TEST(Rfk_Function_invokeErased, ThrowingCall)
+{
+	EXPECT_THROW(rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->invokeErased(nullptr, nullptr), std::logic_error);
+}
+
+//=========================================================
+//================ Function::invokeBatch ==================
+//=========================================================
+
+TEST(Rfk_Function_invokeBatch, SuccessfullCall)
+{
+	NonReflectedClass	nrc;
+	NonReflectedClass	nrc2;
+	NonReflectedClass*	elements[] = { &nrc, &nrc2 };
+
+	rfk::getDatabase().getFileLevelFunctionByName("func_twoParamsNonReflected")->invokeBatch<void, NonReflectedClass, int>(elements, 2u, 42);
+
+	EXPECT_EQ(nrc.i, 42);
+	EXPECT_EQ(nrc2.i, 42);
+}
+
+TEST(Rfk_Function_invokeBatch, SignatureMismatch)
+{
+	NonReflectedClass		nrc;
+	NonReflectedClass*		elements[] = { &nrc };
+	rfk::Function const*	function = rfk::getDatabase().getFileLevelFunctionByName("func_twoParamsNonReflected");
+
+	EXPECT_THROW((function->invokeBatch<int, NonReflectedClass, int>(elements, 1u, 42)), rfk::ReturnTypeMismatch);
+	EXPECT_THROW((function->invokeBatch<void, NonReflectedClass>(elements, 1u)), rfk::ArgCountMismatch);
+
+	EXPECT_EQ(nrc.i, 0);
 }
\ No newline at end of file
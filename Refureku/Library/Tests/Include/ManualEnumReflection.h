@@ -17,9 +17,19 @@ enum class EManualEnumReflection : uint8_t
 };
 
 #include <Refureku/TypeInfo/Archetypes/Enum.h>
+#include <Refureku/TypeInfo/Archetypes/EnumTable.h>
 
 namespace rfk
 {
 	template <>
 	rfk::Enum const* getEnum<EManualEnumReflection>() noexcept;
+
+	template <>
+	struct EnumTable<EManualEnumReflection>
+	{
+		static constexpr std::array<EnumTableEntry<EManualEnumReflection>, 2u> entries{{
+			{"Value1", EManualEnumReflection::Value1},
+			{"Value2", EManualEnumReflection::Value2}
+		}};
+	};
 }
\ No newline at end of file
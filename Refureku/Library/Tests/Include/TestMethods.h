@@ -231,6 +231,36 @@ class CLASS() MultipleNPInheritancePClass : public NoInheritanceNPClass, public
 	MultipleNPInheritancePClass_GENERATED
 };
 
+class CLASS() BatchCallBaseClass : public rfk::Object
+{
+	public:
+		int accumulated = 0;
+
+		METHOD()
+		void setAccumulated(int value)
+		{
+			accumulated = value;
+		}
+
+		METHOD()
+		virtual void accumulate(int value)
+		{
+			accumulated += value;
+		}
+
+	BatchCallBaseClass_GENERATED
+};
+
+class CLASS() BatchCallDerivedClass : public NoInheritancePClass, public BatchCallBaseClass
+{
+	virtual void accumulate(int value) override
+	{
+		accumulated += 2 * value;
+	}
+
+	BatchCallDerivedClass_GENERATED
+};
+
 //TODO: test with parent classes and/or child classes that are not reflected
 //TODO: test with method overrides
 
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string_view>
+
+#include <Refureku/TypeInfo/Archetypes/EnumTable.h>
+
 #include "Generated/TestNestedEnums.rfkh.h"
 
 class NestedEnumInspector;
@@ -122,4 +126,15 @@ class NestedEnumInspector
 		{
 			return rfk::getEnum<NonNestedEnum2::PrivateClassNestedLvl1::PublicEnumNestedLvl2>();
 		}
+
+		//rfk::EnumTable of a non-public nested enum
+		static constexpr std::string_view privateEnumNestedLvl1ToString(int value) noexcept
+		{
+			return rfk::enumToString(static_cast<NonNestedEnum::PrivateEnumNestedLvl1>(value));
+		}
+
+		static constexpr bool privateEnumNestedLvl1FromString(std::string_view name) noexcept
+		{
+			return rfk::stringToEnum<NonNestedEnum::PrivateEnumNestedLvl1>(name).has_value();
+		}
 };
\ No newline at end of file
@@ -36,6 +36,37 @@ TEST(Rfk_ManualReflection, EnumContent)
 	EXPECT_EQ(&e->getEnumValueAt(1), e->getEnumValueByName("Value2"));
 }
 
+TEST(Rfk_ManualReflection, EnumToString)
+{
+	static_assert(rfk::enumToString(EManualEnumReflection::Value1) == "Value1");
+
+	EXPECT_EQ(rfk::enumToString(EManualEnumReflection::Value1), "Value1");
+	EXPECT_EQ(rfk::enumToString(EManualEnumReflection::Value2), "Value2");
+	EXPECT_TRUE(rfk::enumToString(static_cast<EManualEnumReflection>(0)).empty());
+	EXPECT_TRUE(rfk::enumToString(static_cast<EManualEnumReflection>(3)).empty());
+}
+
+TEST(Rfk_ManualReflection, StringToEnum)
+{
+	static_assert(rfk::stringToEnum<EManualEnumReflection>("Value2") == EManualEnumReflection::Value2);
+
+	EXPECT_EQ(rfk::stringToEnum<EManualEnumReflection>("Value1"), EManualEnumReflection::Value1);
+	EXPECT_EQ(rfk::stringToEnum<EManualEnumReflection>("Value2"), EManualEnumReflection::Value2);
+	EXPECT_FALSE(rfk::stringToEnum<EManualEnumReflection>("Value").has_value());
+	EXPECT_FALSE(rfk::stringToEnum<EManualEnumReflection>("value1").has_value());
+	EXPECT_FALSE(rfk::stringToEnum<EManualEnumReflection>("").has_value());
+}
+
+TEST(Rfk_ManualReflection, EnumTableMatchesEnum)
+{
+	rfk::Enum const* e = rfk::getEnum<EManualEnumReflection>();
+
+	for (rfk::EnumTableEntry<EManualEnumReflection> const& entry : rfk::EnumTable<EManualEnumReflection>::entries)
+	{
+		EXPECT_EQ(e->getEnumValueByName(entry.name)->getValue(), static_cast<rfk::int64>(entry.value));
+	}
+}
+
 //=========================================================
 //================ Class manual reflection ================
 //=========================================================
@@ -205,4 +236,90 @@ TEST(Rfk_ManualReflection, NamespaceContent)
 	EXPECT_NE(nested_enum, nullptr);
 	EXPECT_NE(rfk::getDatabase().getEnumById(nested_enum->getId()), nullptr);
 	EXPECT_EQ(nested_enum->getOuterEntity(), np);
+}
+
+//=========================================================
+//================ Metadata arena allocation ==============
+//=========================================================
+
+static int metadataArenaTestFunction(int i)
+{
+	return i * 2;
+}
+
+TEST(Rfk_ManualReflection, MetadataArenaAllocation)
+{
+	rfk::MetadataArena arena;
+
+	EXPECT_EQ(arena.getAliveAllocationsCount(), 0u);
+	EXPECT_EQ(arena.getReservedBytes(), 0u);
+
+	{
+		rfk::MetadataArenaScope scope(arena);
+
+		rfk::Function func("metadataArenaTestFunction", 0u, rfk::getType<int>(), new rfk::NonMemberFunction<int(int)>(&metadataArenaTestFunction), rfk::EFunctionFlags::Default);
+		func.addParameter("i", 0u, rfk::getType<int>());
+
+		//Function implementation, parameter implementation, parameters storage and internal function at least
+		EXPECT_GE(arena.getAliveAllocationsCount(), 4u);
+		EXPECT_GT(arena.getReservedBytes(), 0u);
+		EXPECT_EQ(func.invoke<int>(21), 42);
+	}
+
+	EXPECT_EQ(arena.getAliveAllocationsCount(), 0u);
+}
+
+TEST(Rfk_ManualReflection, MetadataArenaNoScope)
+{
+	rfk::MetadataArena arena;
+
+	{
+		rfk::MetadataArenaScope scope(arena);
+	}
+
+	//Metadata is allocated from the global heap when there is no scope
+	rfk::Function func("metadataArenaTestFunction", 0u, rfk::getType<int>(), new rfk::NonMemberFunction<int(int)>(&metadataArenaTestFunction), rfk::EFunctionFlags::Default);
+
+	EXPECT_EQ(arena.getAliveAllocationsCount(), 0u);
+	EXPECT_EQ(arena.getReservedBytes(), 0u);
+}
+
+TEST(Rfk_ManualReflection, MetadataArenaNestedScopes)
+{
+	rfk::MetadataArena outerArena;
+	rfk::MetadataArena innerArena;
+
+	rfk::MetadataArenaScope outerScope(outerArena);
+
+	{
+		rfk::MetadataArenaScope innerScope(innerArena);
+
+		rfk::Struct s("MetadataArenaStruct", 0u, 1u, false);
+
+		EXPECT_EQ(outerArena.getAliveAllocationsCount(), 0u);
+		EXPECT_GT(innerArena.getAliveAllocationsCount(), 0u);
+	}
+
+	rfk::Struct s("MetadataArenaStruct", 0u, 1u, false);
+
+	EXPECT_GT(outerArena.getAliveAllocationsCount(), 0u);
+	EXPECT_EQ(innerArena.getAliveAllocationsCount(), 0u);
+}
+
+TEST(Rfk_ManualReflection, MetadataArenaOutlivedByMetadata)
+{
+	rfk::Function* func;
+
+	{
+		rfk::MetadataArena arena;
+		rfk::MetadataArenaScope scope(arena);
+
+		func = new rfk::Function("metadataArenaTestFunction", 0u, rfk::getType<int>(), new rfk::NonMemberFunction<int(int)>(&metadataArenaTestFunction), rfk::EFunctionFlags::Default);
+		func->addParameter("i", 0u, rfk::getType<int>());
+	}
+
+	//The arena memory is only released once all the metadata allocated from it is destroyed
+	EXPECT_EQ(func->invoke<int>(4), 8);
+
+	delete func;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <stdexcept>	//std::logic_error
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
@@ -483,4 +484,119 @@ TEST(Rfk_Method_checkedInvoke, ThrowingCall)
 	TestMethodClass instance;
 
 	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("throwing")->checkedInvoke(instance), std::logic_error);
+}
+
+//=========================================================
+//================ Method::invokeErased ===================
+//=========================================================
+
+TEST(Rfk_Method_invokeErased, ReturnByValue)
+{
+	TestMethodClass instance;
+	int				param = 42;
+	void*			args[] = { &param };
+	int				result = 0;
+
+	TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->invokeErased(&instance, args, &result);
+
+	EXPECT_EQ(result, 42);
+
+	//The result can be discarded
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->invokeErased(&instance, args, nullptr));
+}
+
+TEST(Rfk_Method_invokeErased, ReturnByReference)
+{
+	TestMethodClass		instance;
+	NonReflectedClass	param;
+	void*				args[] = { &param };
+	NonReflectedClass*	result = nullptr;
+
+	TestMethodClass::staticGetArchetype().getMethodByName("returnNonReflectedNoParam")->invokeErased(&instance, args, &result);
+
+	EXPECT_EQ(result, &param);
+}
+
+TEST(Rfk_Method_invokeErased, ConstCaller)
+{
+	TestMethodClass const instance;
+
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("constNoReturnNoParam")->invokeErased(&instance, nullptr, nullptr));
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("noReturnNoParam")->invokeErased(&instance, nullptr, nullptr), rfk::ConstViolation);
+}
+
+TEST(Rfk_Method_invokeErased, ThrowingCall)
+{
+	TestMethodClass instance;
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("throwing")->invokeErased(&instance, nullptr, nullptr), std::logic_error);
+}
+
+//=========================================================
+//================= Method::invokeBatch ===================
+//=========================================================
+
+TEST(Rfk_Method_invokeBatch, NonVirtualMethod)
+{
+	BatchCallBaseClass		base;
+	BatchCallDerivedClass	derived;
+	BatchCallBaseClass*		callers[] = { &base, &derived };
+
+	BatchCallBaseClass::staticGetArchetype().getMethodByName("setAccumulated")->invokeBatch<void, BatchCallBaseClass, int>(callers, 2u, 42);
+
+	EXPECT_EQ(base.accumulated, 42);
+	EXPECT_EQ(derived.accumulated, 42);
+}
+
+TEST(Rfk_Method_invokeBatch, VirtualMethodMixedDynamicArchetypes)
+{
+	BatchCallBaseClass		base;
+	BatchCallDerivedClass	derived;
+	BatchCallDerivedClass	derived2;
+	BatchCallBaseClass*		callers[] = { &base, &derived, &base, &derived2, &derived };
+
+	BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate")->invokeBatch<void, BatchCallBaseClass, int>(callers, 5u, 1);
+
+	EXPECT_EQ(base.accumulated, 2);
+	EXPECT_EQ(derived.accumulated, 4);
+	EXPECT_EQ(derived2.accumulated, 2);
+}
+
+TEST(Rfk_Method_invokeBatch, AdjustedCallerPointer)
+{
+	BatchCallDerivedClass	derived;
+	BatchCallDerivedClass	derived2;
+	BatchCallDerivedClass*	callers[] = { &derived, &derived2 };
+
+	BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate")->invokeBatch<void, BatchCallDerivedClass, int>(callers, 2u, 1);
+
+	EXPECT_EQ(derived.accumulated, 2);
+	EXPECT_EQ(derived2.accumulated, 2);
+}
+
+TEST(Rfk_Method_invokeBatch, EmptyBatch)
+{
+	EXPECT_NO_THROW((BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate")->invokeBatch<void, BatchCallBaseClass, int>(static_cast<BatchCallBaseClass* const*>(nullptr), 0u, 1)));
+}
+
+TEST(Rfk_Method_invokeBatch, SignatureMismatch)
+{
+	BatchCallBaseClass	base;
+	BatchCallBaseClass*	callers[] = { &base };
+	rfk::Method const*	method = BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate");
+
+	EXPECT_THROW((method->invokeBatch<int, BatchCallBaseClass, int>(callers, 1u, 1)), rfk::ReturnTypeMismatch);
+	EXPECT_THROW((method->invokeBatch<void, BatchCallBaseClass, float>(callers, 1u, 1.0f)), rfk::ArgTypeMismatch);
+	EXPECT_THROW((method->invokeBatch<void, BatchCallBaseClass>(callers, 1u)), rfk::ArgCountMismatch);
+
+	//No call must have been performed
+	EXPECT_EQ(base.accumulated, 0);
+}
+
+TEST(Rfk_Method_invokeBatch, ConstViolation)
+{
+	BatchCallBaseClass const	base;
+	BatchCallBaseClass const*	callers[] = { &base };
+
+	EXPECT_THROW((BatchCallBaseClass::staticGetArchetype().getMethodByName("accumulate")->invokeBatch<void, BatchCallBaseClass const, int>(callers, 1u, 1)), rfk::ConstViolation);
 }
\ No newline at end of file
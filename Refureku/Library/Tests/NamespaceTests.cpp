@@ -1,5 +1,10 @@
+#include <algorithm>	//std::find
+
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragmentRegisterer.h>
+
+#include "TestProperties.h"
 
 //=========================================================
 //============ Namespace::getNamespaceByName ==============
@@ -1008,4 +1013,33 @@ TEST(Rfk_Namespace_foreachFunction, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getDatabase().getNamespaceByName("test_namespace")->foreachFunction(visitor, nullptr), std::logic_error);
+}
+
+//=========================================================
+//============= NamespaceFragment::addProperty ============
+//=========================================================
+
+TEST(Rfk_NamespaceFragment_addProperty, AfterRegistration)
+{
+	UniqueInheritedProperty		propertyBeforeRegistration(1);
+	MultipleInheritedProperty	propertyAfterRegistration(2);
+
+	rfk::NamespaceFragment fragment("namespace_fragment_add_property", 515151u);
+
+	EXPECT_TRUE(fragment.addProperty(propertyBeforeRegistration));
+
+	rfk::NamespaceFragmentRegisterer registerer(fragment);
+
+	rfk::Namespace const& mergedNamespace = fragment.getMergedNamespace();
+
+	EXPECT_EQ(rfk::getDatabase().getNamespaceByName("namespace_fragment_add_property"), &mergedNamespace);
+	EXPECT_EQ(mergedNamespace.getProperty<UniqueInheritedProperty>(), &propertyBeforeRegistration);
+
+	//Properties added after the registration are forwarded to the merged namespace
+	EXPECT_TRUE(fragment.addProperty(propertyAfterRegistration));
+	EXPECT_EQ(mergedNamespace.getProperty<MultipleInheritedProperty>(), &propertyAfterRegistration);
+
+	rfk::Vector<rfk::Entity const*> entities = rfk::getDatabase().getEntitiesWithProperty<MultipleInheritedProperty>(false);
+
+	EXPECT_NE(std::find(entities.cbegin(), entities.cend(), &mergedNamespace), entities.cend());
 }
\ No newline at end of file
@@ -77,4 +77,32 @@ TEST(Rfk_StaticMethod_checkedInvoke, NonReflectedTypeBypassArgTypeMismatch)
 TEST(Rfk_StaticMethod_checkedInvoke, ThrowingCall)
 {
 	EXPECT_THROW(TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("throwing")->checkedInvoke(), std::logic_error);
+}
+
+//=========================================================
+//============= StaticMethod::invokeErased ================
+//=========================================================
+
+TEST(Rfk_StaticMethod_invokeErased, SuccessfullCall)
+{
+	int		param = 42;
+	void*	args[] = { &param };
+	int		result = 0;
+
+	TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("returnIntParamInt")->invokeErased(args, &result);
+
+	EXPECT_EQ(result, 42);
+
+	NonReflectedClass	nrc;
+	void*				nrcArgs[] = { &nrc };
+	NonReflectedClass*	nrcResult = nullptr;
+
+	TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("returnNonReflectedNoParam")->invokeErased(nrcArgs, &nrcResult);
+
+	EXPECT_EQ(nrcResult, &nrc);
+}
+
+TEST(Rfk_StaticMethod_invokeErased, ThrowingCall)
+{
+	EXPECT_THROW(TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("throwing")->invokeErased(nullptr, nullptr), std::logic_error);
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <stdexcept>	//std::logic_error
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
@@ -51,6 +52,51 @@ TEST(Rfk_Struct_makeSharedInstance, UseDefaultInstantiator)
 	EXPECT_EQ(obj->getI(), 2);
 }
 
+//=========================================================
+//=============== Struct::getInstantiator =================
+//=========================================================
+
+TEST(Rfk_Struct_getInstantiator, UseUserProvidedParamInstantiator)
+{
+	rfk::InstantiatorHandle<BaseObject(int)> instantiator = BaseObject::staticGetArchetype().getInstantiator<BaseObject(int)>();
+
+	EXPECT_TRUE(instantiator.canMakeSharedInstance());
+	EXPECT_EQ(instantiator.makeSharedInstance(2)->getI(), 2);
+	EXPECT_EQ(instantiator.makeSharedInstance(3)->getI(), 3);
+}
+
+TEST(Rfk_Struct_getInstantiator, UseMissingInstantiator)
+{
+	rfk::InstantiatorHandle<BaseObject(float)> instantiator = BaseObject::staticGetArchetype().getInstantiator<BaseObject(float)>();
+
+	EXPECT_FALSE(instantiator.canMakeSharedInstance());
+	EXPECT_FALSE(instantiator.canMakeUniqueInstance());
+	EXPECT_EQ(instantiator.makeSharedInstance(3.14f), nullptr);
+}
+
+TEST(Rfk_Struct_getInstantiator, UseUserProvidedParamlessInstantiator)
+{
+	rfk::InstantiatorHandle<BaseObject()> instantiator = ObjectDerived1::staticGetArchetype().getInstantiator<BaseObject()>();
+
+	EXPECT_EQ(instantiator.makeSharedInstance()->getI(), 1);
+}
+
+TEST(Rfk_Struct_getInstantiator, DefaultHandle)
+{
+	rfk::InstantiatorHandle<BaseObject(int)> instantiator;
+
+	EXPECT_FALSE(instantiator.canMakeSharedInstance());
+	EXPECT_EQ(instantiator.makeSharedInstance(2), nullptr);
+	EXPECT_EQ(instantiator.makeUniqueInstance(2), nullptr);
+}
+
+TEST(Rfk_Struct_getInstantiator, SameInstantiatorAsMakeSharedInstance)
+{
+	std::shared_ptr<BaseObject> obj = BaseObject::staticGetArchetype().makeSharedInstance<BaseObject>(2);
+
+	EXPECT_EQ(obj->getI(), BaseObject::staticGetArchetype().getInstantiator<BaseObject(int)>().makeSharedInstance(2)->getI());
+}
+
 //=========================================================
 //============= Struct::getDirectSubclasses ===============
 //=========================================================
@@ -119,6 +165,39 @@ TEST(Rfk_Struct_isSubclassOf, NonBaseClass)
 	EXPECT_FALSE(BaseObject::staticGetArchetype().isBaseOf(TestClass::staticGetArchetype()));
 }
 
+TEST(Rfk_Struct_isBaseOf, HierarchyChange)
+{
+	rfk::Struct root("IsBaseOfRoot", 1u, 1u, true);
+	rfk::Struct middle("IsBaseOfMiddle", 2u, 1u, true);
+	rfk::Struct leaf("IsBaseOfLeaf", 3u, 1u, true);
+	rfk::Struct otherParent("IsBaseOfOtherParent", 4u, 1u, true);
+
+	middle.addDirectParent(&root, rfk::EAccessSpecifier::Public);
+	root.addSubclass(middle, 0);
+
+	leaf.addDirectParent(&middle, rfk::EAccessSpecifier::Public);
+	middle.addSubclass(leaf, 0);
+	root.addSubclass(leaf, 0);
+
+	//Single inheritance chain
+	EXPECT_TRUE(root.isBaseOf(leaf));
+	EXPECT_TRUE(middle.isBaseOf(leaf));
+	EXPECT_FALSE(leaf.isBaseOf(root));
+	EXPECT_FALSE(middle.isBaseOf(root));
+	EXPECT_FALSE(otherParent.isBaseOf(leaf));
+
+	//Multiple inheritance in the middle of the hierarchy
+	middle.addDirectParent(&otherParent, rfk::EAccessSpecifier::Public);
+	otherParent.addSubclass(middle, 0);
+	otherParent.addSubclass(leaf, 0);
+
+	EXPECT_TRUE(root.isBaseOf(leaf));
+	EXPECT_TRUE(otherParent.isBaseOf(leaf));
+	EXPECT_TRUE(otherParent.isBaseOf(middle));
+	EXPECT_FALSE(leaf.isBaseOf(otherParent));
+	EXPECT_TRUE(leaf.isSubclassOf(otherParent));
+}
+
 //=========================================================
 //============= Struct::getDirectParentsCount =============
 //=========================================================
@@ -880,6 +959,42 @@ TEST(Rfk_Struct_foreachField, ThrowingVisitor)
 	EXPECT_THROW(TestClass::staticGetArchetype().foreachField(visitor, nullptr), std::logic_error);
 }
 
+TEST(Rfk_Struct_foreachField, RegistrationOrder)
+{
+	rfk::Struct s("RegistrationOrderStruct", 1u, 16u, false);
+
+	s.setFieldsCapacity(2u);
+
+	//Add more fields than the reserved capacity to make sure the storage grows without moving the already added fields
+	std::vector<rfk::Field const*> addedFields;
+	char const* names[] = { "d", "c", "b", "a", "c", "e", "f" };
+
+	for (std::size_t i = 0u; i < sizeof(names) / sizeof(names[0]); i++)
+	{
+		addedFields.push_back(s.addField(names[i], 10u + i, rfk::getType<int>(), rfk::EFieldFlags::Public, i * sizeof(int), &s));
+	}
+
+	std::vector<rfk::Field const*> visitedFields;
+	auto visitor = [](rfk::Field const& field, void* data)
+	{
+		reinterpret_cast<std::vector<rfk::Field const*>*>(data)->push_back(&field);
+
+		return true;
+	};
+
+	EXPECT_TRUE(s.foreachField(visitor, &visitedFields));
+	EXPECT_EQ(visitedFields, addedFields);
+	EXPECT_EQ(s.getFieldsCount(), addedFields.size());
+
+	//Name lookups
+	EXPECT_EQ(s.getFieldByName("a"), addedFields[3]);
+	EXPECT_EQ(s.getFieldByName("f"), addedFields[6]);
+	EXPECT_EQ(s.getFieldByName("g"), nullptr);
+
+	rfk::Field const* c = s.getFieldByName("c");
+	EXPECT_TRUE(c == addedFields[1] || c == addedFields[4]);
+}
+
 //=========================================================
 //================ Struct::getFieldsCount =================
 //=========================================================
@@ -1117,6 +1232,38 @@ TEST(Rfk_Struct_getMethodByName, ValidNameValidFlagsWithInherited)
 	EXPECT_NE(TestClass2::staticGetArchetype().getMethodByName("getIntField", rfk::EMethodFlags::Public, true), nullptr);
 }
 
+TEST(Rfk_Struct_getMethodByName, InheritedHierarchyChange)
+{
+	rfk::Struct base("InheritedHierarchyChangeBase", 1u, 1u, true);
+	rfk::Struct child("InheritedHierarchyChangeChild", 2u, 1u, true);
+
+	rfk::Method const* baseMethod = base.addMethod("method", 3u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public | rfk::EMethodFlags::Virtual);
+
+	//Look up the method before the hierarchy is complete
+	EXPECT_EQ(child.getMethodByName("method", rfk::EMethodFlags::Default, true), nullptr);
+
+	child.addDirectParent(&base, rfk::EAccessSpecifier::Public);
+	base.addSubclass(child, 0);
+
+	EXPECT_EQ(child.getMethodByName("method", rfk::EMethodFlags::Default, true), baseMethod);
+
+	//Methods added to a parent after a lookup must be found from the subclasses
+	rfk::Method const* lateMethod = base.addMethod("lateMethod", 4u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public);
+
+	EXPECT_EQ(child.getMethodByName("lateMethod", rfk::EMethodFlags::Default, true), lateMethod);
+
+	//Overriding methods must be found before the methods they override
+	rfk::Method const* overrideMethod = child.addMethod("method", 5u, rfk::getType<void>(), nullptr, rfk::EMethodFlags::Public | rfk::EMethodFlags::Virtual);
+
+	EXPECT_EQ(child.getMethodByName("method", rfk::EMethodFlags::Default, true), overrideMethod);
+
+	rfk::Vector<rfk::Method const*> methods = child.getMethodsByName("method", rfk::EMethodFlags::Default, true);
+
+	ASSERT_EQ(methods.size(), 2u);
+	EXPECT_EQ(methods[0], overrideMethod);
+	EXPECT_EQ(methods[1], baseMethod);
+}
+
 //=========================================================
 //================ Struct::getMethodsByName ===============
 //=========================================================
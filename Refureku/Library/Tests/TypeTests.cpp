@@ -1,3 +1,9 @@
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <utility>	//std::index_sequence
+
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
 
@@ -12,6 +18,60 @@ TEST(Rfk_getType, AddressCheck)
 	EXPECT_EQ(&rfk::getType<TestClass>(), &rfk::getType<TestClass>());
 }
 
+template <std::size_t Index>
+struct ConcurrentFirstUseStruct {};
+
+template <std::size_t Index>
+void concurrentFirstUseGetType()
+{
+	using TestedType = ConcurrentFirstUseStruct<Index> const* volatile* const&;
+
+	constexpr std::size_t threadsCount = 8u;
+
+	std::atomic<bool>								start{false};
+	std::array<rfk::Type const*, threadsCount>		results{};
+	std::vector<std::thread>						threads;
+
+	for (std::size_t i = 0u; i < threadsCount; i++)
+	{
+		threads.emplace_back([&start, &results, i]()
+							 {
+								 //Spin to maximize the chances of concurrent first use
+								 while (!start.load(std::memory_order_acquire))
+								 {
+									 std::this_thread::yield();
+								 }
+
+								 results[i] = &rfk::getType<TestedType>();
+							 });
+	}
+
+	start.store(true, std::memory_order_release);
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (rfk::Type const* result : results)
+	{
+		EXPECT_EQ(result, &rfk::getType<TestedType>());
+		EXPECT_EQ(result->getTypePartsCount(), 4u);
+		EXPECT_TRUE(result->isLValueReference());
+	}
+}
+
+template <std::size_t... Indices>
+void concurrentFirstUseGetType(std::index_sequence<Indices...>)
+{
+	(concurrentFirstUseGetType<Indices>(), ...);
+}
+
+TEST(Rfk_getType, ConcurrentFirstUse)
+{
+	concurrentFirstUseGetType(std::make_index_sequence<64u>());
+}
+
 //=========================================================
 //============== Type::getTypePartsCount ==================
 //=========================================================
@@ -606,4 +666,66 @@ TEST(Rfk_Type_getArchetype, TypeConstPtr)
 TEST(Rfk_Type_getArchetype, ArrayType)
 {
 	EXPECT_EQ(rfk::getType<TestClass[5]>().getArchetype(), rfk::getArchetype<TestClass>());
+}
+
+//=========================================================
+//=================== Type::operator== ====================
+//=========================================================
+
+TEST(Rfk_Type_operatorEqual, CanonicalTypes)
+{
+	EXPECT_TRUE(rfk::getType<TestClass const*>() == rfk::getType<TestClass const*>());
+	EXPECT_FALSE(rfk::getType<TestClass const*>() == rfk::getType<TestClass*>());
+	EXPECT_FALSE(rfk::getType<TestClass>() == rfk::getType<int>());
+}
+
+TEST(Rfk_Type_operatorEqual, ManuallyFilledType)
+{
+	rfk::Type type;
+
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Ptr);
+	type.addTypePart().addDescriptorFlag(rfk::ETypePartDescriptor::Value);
+	type.setArchetype(&TestClass::staticGetArchetype());
+
+	EXPECT_TRUE(type == rfk::getType<TestClass*>());
+	EXPECT_TRUE(rfk::getType<TestClass*>() == type);
+	EXPECT_FALSE(type == rfk::getType<TestClass const*>());
+}
+
+//=========================================================
+//================ Type parts storage =====================
+//=========================================================
+
+TEST(Rfk_Type_partsStorage, DeepPointerChain)
+{
+	rfk::Type const& type = rfk::getType<TestClass const* volatile* const** const&>();
+
+	ASSERT_EQ(type.getTypePartsCount(), 6u);
+	EXPECT_TRUE(type.getTypePartAt(0).isLValueReference());
+	EXPECT_TRUE(type.getTypePartAt(1).isPointer());
+	EXPECT_TRUE(type.getTypePartAt(1).isConst());
+	EXPECT_TRUE(type.getTypePartAt(4).isVolatile());
+	EXPECT_TRUE(type.getTypePartAt(5).isValue());
+	EXPECT_TRUE(type.getTypePartAt(5).isConst());
+	EXPECT_EQ(type.getArchetype(), &TestClass::staticGetArchetype());
+}
+
+TEST(Rfk_Type_partsStorage, CopyAndMove)
+{
+	rfk::Type const&	deepType	= rfk::getType<TestClass*** const&>();
+	rfk::Type			copy		= deepType;
+
+	EXPECT_TRUE(copy == deepType);
+
+	rfk::Type moved = std::move(copy);
+
+	EXPECT_TRUE(moved == deepType);
+
+	moved = rfk::getType<TestClass*>();
+
+	EXPECT_TRUE(moved == rfk::getType<TestClass*>());
+
+	moved = deepType;
+
+	EXPECT_TRUE(moved == deepType);
 }
\ No newline at end of file